@@ -1,10 +1,10 @@
 /**
  * @file at24cm0x.c
- *
+ * 
  * @brief Implementation of the AT24CM0X driver functions.
- *
+ * 
  * This file contains the implementation of functions to initialize the AT24CM0X device, write and read data from/to eeprom. It utilizes TWI/I2C communication to interact with the AT24CM0X hardware.
- *
+ * 
  * @author g.raf
  * @date 2026-01-25
  * @version 1.0 Release
@@ -19,224 +19,2626 @@
 
 #include "at24cm0x.h"
 
-volatile unsigned char at24cm0x_device_identifier;
+#ifdef AT24CM0X_MULTI_DEVICES
+	static AT24CM0X_Device at24cm0x_devices[AT24CM0X_DEVICES];
+#else
+	static AT24CM0X_Device at24cm0x_devices[1];
+#endif
 
-/**
- * @brief Initializes the AT24CM0X EEPROM driver.
- * 
- * @details
- * This function initializes the internal configuration of the AT24CM0X driver. If write-protect control is enabled at compile time (`AT24CM0X_WP_CONTROL_EN`), it first activates write-protect by calling @ref at24cm0x_wp with @ref AT24CM0X_WP_Mode_Enabled. It then sets the internal device identifier used for I2C communication to either @ref AT24CM0X_BASE_ADDRESS when multi-device support is enabled (`AT24CM0X_MULTI_DEVICES`), or to @ref AT24CM0X_ADDRESS when operating in single-device mode.
- * 
- * @note This function should be called once during system startup before any AT24CM0X read or write operations are performed.
- */
-void at24cm0x_init(void)
-{
-	#ifdef AT24CM0X_WP_CONTROL_EN
-		at24cm0x_wp(AT24CM0X_WP_Mode_Enabled);
-	#endif
+static AT24CM0X_Device *at24cm0x_active = at24cm0x_devices;
+
+#ifdef AT24CM0X_ENABLE_READ_CACHE
+	static struct
+	{
+		AT24CM0X_Device *device;
+		unsigned long tag;
+		unsigned char valid;
+		unsigned char data[AT24CM0X_READ_CACHE_LINE_SIZE];
+	} at24cm0x_read_cache[AT24CM0X_READ_CACHE_LINES];
 	
-	#ifdef AT24CM0X_MULTI_DEVICES
-		at24cm0x_device_identifier = AT24CM0X_BASE_ADDRESS;
-	#else
-		at24cm0x_device_identifier = AT24CM0X_ADDRESS;
-	#endif
-}
+	static unsigned long at24cm0x_read_cache_hits;
+	static unsigned long at24cm0x_read_cache_misses;
+#endif
 
-#ifdef AT24CM0X_MULTI_DEVICES
+#ifdef AT24CM0X_ENABLE_READ_AHEAD
+	static struct
+	{
+		AT24CM0X_Device *device;
+		unsigned long address;
+		unsigned int size;
+		unsigned long next;
+		unsigned char data[AT24CM0X_READ_AHEAD_SIZE];
+	} at24cm0x_read_ahead;
+#endif
+
+#ifdef AT24CM0X_ENABLE_CONDITIONAL_WRITE
+	static unsigned long at24cm0x_skipped_bytes;
+	static unsigned long at24cm0x_skipped_cycles;
+#endif
+
+#ifdef AT24CM0X_ENABLE_WRITE_QUEUE
+	static struct
+	{
+		AT24CM0X_Device *device;
+		unsigned long address;
+		unsigned int size;
+		unsigned char data[AT24CM0X_WRITE_QUEUE_SPAN_SIZE];
+	} at24cm0x_queue[AT24CM0X_WRITE_QUEUE_ENTRIES];
+	
+	static unsigned char at24cm0x_queue_count;
+	static unsigned long at24cm0x_queue_timestamp;
+#endif
+
+#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+	static AT24CM0X_Instrumentation at24cm0x_counters;
+	
+	static void at24cm0x_instrument_error(TWI_Error error)
+	{
+		for (unsigned char i=0; i < AT24CM0X_INSTRUMENTATION_ERROR_BITS; i++)
+		{
+			if(((unsigned int)error>>i) & 0x01)
+			{
+				at24cm0x_counters.twi_errors[i]++;
+			}
+		}
+	}
+	
 	/**
-	 * @brief Selects the active AT24CM0X device.
+	 * @brief Returns the instrumentation counters of the driver.
 	 * 
 	 * @details
-	 * This function updates the internal device identifier used by the AT24CM0X driver to communicate with a specific EEPROM device on the I2C bus. The given identifier is masked with the configured @ref AT24CM0X_ADDRESS_MASK and combined with @ref AT24CM0X_BASE_ADDRESS to form the effective 7-bit I2C address stored in the internal `at24cm0x_device_identifier`.
+	 * The counters are updated on the hot paths of the driver when @ref AT24CM0X_ENABLE_INSTRUMENTATION is defined and are cleared by @ref at24cm0x_init.
 	 * 
-	 * @param identifier Device selector value used to derive the target AT24CM0X I2C address.
+	 * @param instrumentation Pointer to the structure that receives a copy of the current counters.
 	 */
-	void at24cm0x_device(unsigned char identifier)
+	void at24cm0x_instrumentation(AT24CM0X_Instrumentation *instrumentation)
+	{
+		*instrumentation = at24cm0x_counters;
+	}
+	
+	/**
+	 * @brief Hook that is called at the begin of a traced bus transaction.
+	 * 
+	 * @details
+	 * The default implementation is weak and empty. The application can provide its own implementation, e.g. to toggle a debug pin or to record the transaction into a trace buffer.
+	 * 
+	 * @param trace     Kind of the transaction.
+	 * @param device    Pointer to the device handle of the transaction.
+	 * @param address   Start address of the transaction.
+	 * @param size      Number of bytes of the transaction.
+	 * @param timestamp Value of @ref at24cm0x_timestamp at the begin of the transaction.
+	 */
+	__attribute__((weak)) void at24cm0x_trace_begin(AT24CM0X_Trace trace, const AT24CM0X_Device *device, unsigned long address, unsigned int size, unsigned long timestamp)
+	{
+		(void)trace;
+		(void)device;
+		(void)address;
+		(void)size;
+		(void)timestamp;
+	}
+	
+	/**
+	 * @brief Hook that is called at the end of a traced bus transaction.
+	 * 
+	 * @details
+	 * The default implementation is weak and empty. Together with @ref at24cm0x_trace_begin the duration and the result of every transaction can be recorded.
+	 * 
+	 * @param trace     Kind of the transaction.
+	 * @param device    Pointer to the device handle of the transaction.
+	 * @param status    Result of the transaction.
+	 * @param timestamp Value of @ref at24cm0x_timestamp at the end of the transaction.
+	 */
+	__attribute__((weak)) void at24cm0x_trace_end(AT24CM0X_Trace trace, const AT24CM0X_Device *device, AT24CM0X_Status status, unsigned long timestamp)
 	{
-		at24cm0x_device_identifier = AT24CM0X_BASE_ADDRESS | (identifier & AT24CM0X_ADDRESS_MASK);
+		(void)trace;
+		(void)device;
+		(void)status;
+		(void)timestamp;
 	}
 #endif
 
-#ifdef AT24CM0X_WRITE_ACKNOWLEDGE_POLLING
-	static void at24cm0x_write_acknowledge_polling(void)
+#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+	static unsigned long at24cm0x_stream_address;
+	
+	static void at24cm0x_pointer_read(AT24CM0X_Device *device, unsigned long address, unsigned long size, unsigned char valid)
 	{
-		TWI_Error error = TWI_None;
+		device->pointer = (valid ? ((address + size) & AT24CM0X_MEMORY_MASK) : AT24CM0X_MEMORY_SIZE);
+	}
+	
+	static void at24cm0x_pointer_write(AT24CM0X_Device *device, unsigned long address, unsigned int size, unsigned char valid)
+	{
+		unsigned long offset = (address & AT24CM0X_PAGE_MASK);
+		
+		device->pointer = (valid ? ((address - offset) + ((offset + size) & AT24CM0X_PAGE_MASK)) : AT24CM0X_MEMORY_SIZE);
+	}
+#endif
+
+static void at24cm0x_wait_ms(unsigned int ms)
+{
+	#if defined(AT24CM0X_ENABLE_OS_HOOKS)
+		at24cm0x_os_sleep(ms);
+	#elif defined(AT24CM0X_ENABLE_LOW_POWER)
+		at24cm0x_power_sleep(ms);
+	#else
+		systick_timer_wait_ms(ms);
+	#endif
+}
+
+#ifdef AT24CM0X_POWER_CONTROL_EN
+	static unsigned char at24cm0x_powered;
+#endif
+
+#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+	static struct
+	{
+		AT24CM0X_Speed_Profile profile;
+		unsigned long frequency;
+		unsigned char errors;
+	} at24cm0x_speed;
+	
+	static void at24cm0x_speed_select(TWI_Operation operation)
+	{
+		unsigned long frequency = AT24CM0X_SPEED_SAFE_HZ;
 		
-		do
+		if(at24cm0x_speed.profile == AT24CM0X_Speed_Profile_Fast)
 		{
-			twi_start();
-			error = twi_address(at24cm0x_device_identifier, TWI_Write);
-		} while (error == TWI_Ack);
-		twi_stop();
+			frequency = (operation == TWI_Read ? AT24CM0X_SPEED_READ_HZ : AT24CM0X_SPEED_WRITE_HZ);
+		}
+		
+		if(frequency != at24cm0x_speed.frequency)
+		{
+			twi_frequency(frequency);
+			at24cm0x_speed.frequency = frequency;
+		}
+	}
+	
+	static void at24cm0x_speed_update(TWI_Error error)
+	{
+		if(error == TWI_None)
+		{
+			at24cm0x_speed.errors = 0;
+			return;
+		}
+		
+		if(++at24cm0x_speed.errors >= AT24CM0X_SPEED_FALLBACK_ERRORS)
+		{
+			at24cm0x_speed.profile = AT24CM0X_Speed_Profile_Safe;
+			at24cm0x_speed.errors = 0;
+		}
+	}
+	
+	/**
+	 * @brief Selects the bus speed profile of the AT24CM0X driver.
+	 * 
+	 * @details
+	 * This function selects the bus clocks used for the following transactions (see @ref AT24CM0X_ENABLE_SPEED_PROFILES). The clock is changed with the next transaction. Selecting @ref AT24CM0X_Speed_Profile_Fast after an automatic fallback returns to the fast rates, e.g. once a noisy period is over. The error counter of the fallback is reset.
+	 * 
+	 * @param profile Speed profile to use.
+	 */
+	void at24cm0x_speed_profile(AT24CM0X_Speed_Profile profile)
+	{
+		at24cm0x_speed.profile = profile;
+		at24cm0x_speed.errors = 0;
+	}
+	
+	/**
+	 * @brief Returns the bus speed profile of the AT24CM0X driver.
+	 * 
+	 * @details
+	 * The profile is either the one selected with @ref at24cm0x_speed_profile or @ref AT24CM0X_Speed_Profile_Safe after @ref AT24CM0X_SPEED_FALLBACK_ERRORS failing transactions in a row.
+	 * 
+	 * @return AT24CM0X_Speed_Profile Speed profile in use.
+	 */
+	AT24CM0X_Speed_Profile at24cm0x_speed_current(void)
+	{
+		return at24cm0x_speed.profile;
 	}
 #endif
 
-static TWI_Error at24cm0x_send_address(unsigned long address)
+static void at24cm0x_bus_start(TWI_Operation operation)
 {
-	unsigned char high_byte = (at24cm0x_device_identifier | (AT24CM0X_ADDRESS_HIGH_MASK & (unsigned char)(address>>16)));
-	unsigned char middle_byte = (unsigned char)(address>>8);
-	unsigned char low_byte = (unsigned char)(address);
+	#ifdef AT24CM0X_POWER_CONTROL_EN
+		if(!at24cm0x_powered)
+		{
+			at24cm0x_power(AT24CM0X_Power_Mode_On);
+			at24cm0x_wait_ms(AT24CM0X_POWER_UP_MS);
+			at24cm0x_powered = 1;
+		}
+	#endif
 	
-	TWI_Error error = TWI_None;
+	#ifdef AT24CM0X_ENABLE_OS_HOOKS
+		at24cm0x_os_lock();
+	#endif
 	
-	error |= twi_address(high_byte, TWI_Write);
-	error |= twi_set(middle_byte);
-	error |= twi_set(low_byte);
+	#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+		at24cm0x_speed_select(operation);
+	#else
+		(void)operation;
+	#endif
 	
-	return error;
+	twi_start();
+}
+
+static void at24cm0x_bus_stop(void)
+{
+	twi_stop();
+	
+	#ifdef AT24CM0X_ENABLE_OS_HOOKS
+		at24cm0x_os_unlock();
+	#endif
 }
 
+#ifdef AT24CM0X_TWI_BUFFER_TRANSFER
+	static void at24cm0x_buffer_wait(void)
+	{
+		while(twi_buffer_busy())
+		{
+			#ifdef AT24CM0X_ENABLE_OS_HOOKS
+				at24cm0x_os_yield();
+			#endif
+		}
+	}
+#endif
+
 /**
- * @brief Writes a single byte to the AT24CM0X EEPROM.
+ * @brief Initializes the AT24CM0X EEPROM driver.
  * 
  * @details
- * This function writes one byte of data to the specified EEPROM address of the AT24CM0X device. It first checks whether the given address is within the valid memory range defined by @ref AT24CM0X_MEMORY_SIZE; if not, it returns @ref AT24CM0X_Status_Address_Error. If write-protect control is enabled (@ref AT24CM0X_WP_CONTROL_EN), the function temporarily disables write-protect before issuing the write and re-enables it afterward. The write operation itself is performed using the TWI/I2C interface: a start condition is sent, the device/address sequence is transmitted via @ref at24cm0x_send_address, the data byte is written, and a stop condition is generated.
- * 
- * After the write, the function either performs write acknowledge polling (@ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING) or waits for a fixed write cycle time (@ref AT24CM0X_WRITE_CYCLE_MS), depending on the compile-time configuration. If any TWI communication error occurs, it returns @ref AT24CM0X_Status_TWI_Error.
- * 
- * When integrity checking is enabled (@ref AT24CM0X_ENABLE_INTEGRITY_CHECK), the function reads back the byte using @ref at24cm0x_read_byte and compares it with the original value; if they do not match, it returns @ref AT24CM0X_Status_Data_Error. On success, the function returns @ref AT24CM0X_Status_Done.
- * 
- * @param address EEPROM memory address at which the byte will be written.
- * @param data    Data byte to write to the specified address.
+ * This function initializes the internal configuration of the AT24CM0X driver. If write-protect control is enabled at compile time (`AT24CM0X_WP_CONTROL_EN`), it first activates write-protect by calling @ref at24cm0x_wp with @ref AT24CM0X_WP_Mode_Enabled. With `AT24CM0X_POWER_CONTROL_EN` the supply is switched off until the first bus transaction. It then sets the internal device identifier used for I2C communication to either @ref AT24CM0X_BASE_ADDRESS when multi-device support is enabled (`AT24CM0X_MULTI_DEVICES`), or to @ref AT24CM0X_ADDRESS when operating in single-device mode.
  * 
- * @return AT24CM0X_Status Status code indicating the result of the operation.
+ * @note This function should be called once during system startup before any AT24CM0X read or write operations are performed.
  */
-AT24CM0X_Status at24cm0x_write_byte(unsigned long address, unsigned char data)
+void at24cm0x_init(void)
 {
-	TWI_Error error = TWI_None;
-	
-	if(address >= AT24CM0X_MEMORY_SIZE)
-	{
-		return AT24CM0X_Status_Address_Error;
-	}
-	
 	#ifdef AT24CM0X_WP_CONTROL_EN
-		at24cm0x_wp(AT24CM0X_WP_Mode_Disabled);
+		at24cm0x_wp(AT24CM0X_WP_Mode_Enabled);
 	#endif
 	
-	twi_start();
-	error |= at24cm0x_send_address(address);
-	error |= twi_set(data);
-	twi_stop();
-	
-	#ifdef AT24CM0X_WRITE_ACKNOWLEDGE_POLLING
-		at24cm0x_write_acknowledge_polling();
-	#else
-		systick_timer_wait_ms(AT24CM0X_WRITE_CYCLE_MS);
+	#ifdef AT24CM0X_POWER_CONTROL_EN
+		at24cm0x_power(AT24CM0X_Power_Mode_Off);
+		at24cm0x_powered = 0;
 	#endif
 	
-	#ifdef AT24CM0X_WP_CONTROL_EN
-		at24cm0x_wp(AT24CM0X_WP_Mode_Enabled);
+	#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+		at24cm0x_speed.profile = AT24CM0X_Speed_Profile_Fast;
+		at24cm0x_speed.frequency = 0;
+		at24cm0x_speed.errors = 0;
 	#endif
-		
-	if(error != TWI_None)
+	
+	for (unsigned char i=0; i < (sizeof(at24cm0x_devices)/sizeof(at24cm0x_devices[0])); i++)
 	{
-		return AT24CM0X_Status_TWI_Error;
+		at24cm0x_device_init((at24cm0x_devices + i), (unsigned char)(i<<AT24CM0X_ADDRESS_SHIFT));
 	}
 	
-	#ifdef AT24CM0X_ENABLE_INTEGRITY_CHECK
-		unsigned char temp = 0;
-		
-		if(at24cm0x_read_byte(address, &temp) != AT24CM0X_Status_Done)
-		{
-			return AT24CM0X_Status_TWI_Error;
-		}
-		
-		if(data != temp)
+	#ifndef AT24CM0X_MULTI_DEVICES
+		at24cm0x_devices[0].identifier = AT24CM0X_ADDRESS;
+	#endif
+	at24cm0x_active = at24cm0x_devices;
+	
+	#ifdef AT24CM0X_ENABLE_READ_CACHE
+		for (unsigned char i=0; i < AT24CM0X_READ_CACHE_LINES; i++)
 		{
-			return AT24CM0X_Status_Data_Error;
+			at24cm0x_read_cache[i].valid = 0;
 		}
+		at24cm0x_read_cache_hits = 0;
+		at24cm0x_read_cache_misses = 0;
 	#endif
 	
-	return AT24CM0X_Status_Done;
+	#ifdef AT24CM0X_ENABLE_READ_AHEAD
+		at24cm0x_read_ahead.device = 0;
+		at24cm0x_read_ahead.address = 0;
+		at24cm0x_read_ahead.size = 0;
+		at24cm0x_read_ahead.next = 0;
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_CONDITIONAL_WRITE
+		at24cm0x_skipped_bytes = 0;
+		at24cm0x_skipped_cycles = 0;
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_WRITE_QUEUE
+		at24cm0x_queue_count = 0;
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+		at24cm0x_counters = (AT24CM0X_Instrumentation){0};
+	#endif
 }
 
 /**
- * @brief Writes a sequence of bytes to a single EEPROM page.
+ * @brief Initializes an AT24CM0X device handle.
  * 
  * @details
- * This function writes a contiguous block of data to one page of the AT24CM0X EEPROM. It first validates the page index against @ref AT24CM0X_PAGES and the data length against @ref AT24CM0X_PAGE_SIZE; if the page is out of range, it returns @ref AT24CM0X_Status_Page_Error, and if the size is zero or not within the allowed page size, it returns @ref AT24CM0X_Status_Size_Error.
- * 
- * The target EEPROM address is calculated from the page index and @ref AT24CM0X_PAGE_SIZE. If write-protect control is enabled (@ref AT24CM0X_WP_CONTROL_EN), write-protect is temporarily disabled before the TWI/I2C transfer and re-enabled afterward. The function then issues a start condition, sends the device/address sequence via @ref at24cm0x_send_address, and transmits each byte from the provided buffer using @ref twi_set, followed by a stop condition.
- * 
- * After the write operation, the function either performs write acknowledge polling (@ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING) or waits for a fixed write cycle time (@ref AT24CM0X_WRITE_CYCLE_MS), depending on the compile-time configuration. If any TWI error is detected, it returns @ref AT24CM0X_Status_TWI_Error.
+ * This function prepares a handle for the handle based functions (e.g. @ref at24cm0x_device_write or @ref at24cm0x_device_read_sequential). The given identifier is masked with @ref AT24CM0X_ADDRESS_MASK and combined with @ref AT24CM0X_BASE_ADDRESS to form the 7-bit I2C address of the device. The usable size is set to @ref AT24CM0X_MEMORY_SIZE and the shadow of the internal address counter is marked as unknown.
  * 
- * When integrity checking is enabled (@ref AT24CM0X_ENABLE_INTEGRITY_CHECK), the function reads back the written data using @ref at24cm0x_read_sequential into a temporary buffer and compares it byte-by-byte with the original data. If any mismatch is found, it returns @ref AT24CM0X_Status_Data_Error. On success, the function returns @ref AT24CM0X_Status_Done.
+ * Handles are independent of the device selected with @ref at24cm0x_device, so several devices can be accessed without switching the global selection. The cache lines of @ref AT24CM0X_ENABLE_WRITE_CACHE and @ref AT24CM0X_ENABLE_READ_CACHE are tagged with the handle they belong to.
  * 
- * @param page Page index to write, in the range [0, @ref AT24CM0X_PAGES - 1].
- * @param data Pointer to the buffer containing the data to be written.
- * @param size Number of bytes to write; must be greater than 0 and less than @ref AT24CM0X_PAGE_SIZE.
+ * @note Only one handle per physical device should be used, otherwise the tracked address counter and the caches of the handles get out of sync.
  * 
- * @return AT24CM0X_Status Status code indicating the result of the operation.
+ * @param device     Pointer to the handle that will be initialized.
+ * @param identifier Device selector value used to derive the I2C address of the device.
  */
-AT24CM0X_Status at24cm0x_write_page(unsigned int page, unsigned char *data, unsigned int size)
+void at24cm0x_device_init(AT24CM0X_Device *device, unsigned char identifier)
 {
-	TWI_Error error = TWI_None;
+	device->identifier = AT24CM0X_BASE_ADDRESS | (identifier & AT24CM0X_ADDRESS_MASK);
+	device->size = AT24CM0X_MEMORY_SIZE;
+	device->pointer = AT24CM0X_MEMORY_SIZE;
+}
 
-	if(page >= AT24CM0X_PAGES)
-	{
-		return AT24CM0X_Status_Page_Error;
-	}
-	
-	if(size == 0 || size >= AT24CM0X_PAGE_SIZE)
+#ifdef AT24CM0X_MULTI_DEVICES
+	/**
+	 * @brief Selects the active AT24CM0X device.
+	 * 
+	 * @details
+	 * This function selects the device used by the global (non-handle) functions of the AT24CM0X driver. The given identifier is masked with the configured @ref AT24CM0X_ADDRESS_MASK and selects one of the internal device handles, whose effective 7-bit I2C address is @ref AT24CM0X_BASE_ADDRESS combined with the masked identifier.
+	 * 
+	 * Every device keeps its own tracked address counter and its own cache lines, so switching between devices does not flush or invalidate any cached data.
+	 * 
+	 * @param identifier Device selector value used to derive the target AT24CM0X I2C address.
+	 */
+	void at24cm0x_device(unsigned char identifier)
 	{
-		return AT24CM0X_Status_Size_Error;
+		at24cm0x_active = at24cm0x_devices + ((identifier & AT24CM0X_ADDRESS_MASK)>>AT24CM0X_ADDRESS_SHIFT);
 	}
 	
-	unsigned long address = (page * AT24CM0X_PAGE_SIZE);
-	
-	#ifdef AT24CM0X_WP_CONTROL_EN
-		at24cm0x_wp(AT24CM0X_WP_Mode_Disabled);
-	#endif
-	
-	twi_start();
-	at24cm0x_send_address(address);
-	
-	for (unsigned int i=0; i < size; i++)
+	/**
+	 * @brief Returns the internal handle of an AT24CM0X device.
+	 * 
+	 * @details
+	 * This function returns the handle that is used by the global functions after @ref at24cm0x_device has been called with the same identifier. Passing it to the handle based functions shares the tracked address counter and the cache lines with the global functions and with @ref at24cm0x_write_parallel, so no second handle for the same device is needed.
+	 * 
+	 * @param identifier Device selector value used to derive the target AT24CM0X I2C address.
+	 * 
+	 * @return AT24CM0X_Device* Pointer to the internal handle of the device.
+	 */
+	AT24CM0X_Device* at24cm0x_device_handle(unsigned char identifier)
 	{
-		error |= twi_set(*(data + i));
+		return at24cm0x_devices + ((identifier & AT24CM0X_ADDRESS_MASK)>>AT24CM0X_ADDRESS_SHIFT);
 	}
-	twi_stop();
-	
-	#ifdef AT24CM0X_WRITE_ACKNOWLEDGE_POLLING
-		at24cm0x_write_acknowledge_polling();
-	#else
-		systick_timer_wait_ms(AT24CM0X_WRITE_CYCLE_MS);
-	#endif
-	
-	#ifdef AT24CM0X_WP_CONTROL_EN
-		at24cm0x_wp(AT24CM0X_WP_Mode_Enabled);
-	#endif
-	
-	#ifdef AT24CM0X_ENABLE_INTEGRITY_CHECK
-		unsigned char buffer[AT24CM0X_PAGE_SIZE];
+#endif
+
+#ifdef AT24CM0X_WRITE_ACKNOWLEDGE_POLLING
+	#ifdef AT24CM0X_ENABLE_WRITE_CYCLE_STATISTICS
+		static AT24CM0X_Write_Cycle_Statistics at24cm0x_write_cycle_stats;
+		static unsigned long at24cm0x_write_cycle_total;
 		
-		if(at24cm0x_read_sequential(address, buffer, size) != AT24CM0X_Status_Done)
+		static void at24cm0x_write_cycle_record(unsigned int elapsed)
 		{
-			return AT24CM0X_Status_TWI_Error;
+			if(at24cm0x_write_cycle_stats.count == 0 || elapsed < at24cm0x_write_cycle_stats.minimum)
+			{
+				at24cm0x_write_cycle_stats.minimum = elapsed;
+			}
+			
+			if(elapsed > at24cm0x_write_cycle_stats.maximum)
+			{
+				at24cm0x_write_cycle_stats.maximum = elapsed;
+			}
+			at24cm0x_write_cycle_total += elapsed;
+			at24cm0x_write_cycle_stats.count++;
+			at24cm0x_write_cycle_stats.average = (unsigned int)(at24cm0x_write_cycle_total / at24cm0x_write_cycle_stats.count);
 		}
 		
-		for (unsigned int i=0; i < size; i++)
+		/**
+		 * @brief Returns the measured write cycle statistics.
+		 * 
+		 * @details
+		 * The statistics are collected by the write acknowledge polling (@ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING) for every completed write cycle. The values are based on the poll interval @ref AT24CM0X_WRITE_POLL_INTERVAL_MS and can be used to check whether the parts finish well below @ref AT24CM0X_WRITE_CYCLE_MS.
+		 * 
+		 * @param statistics Pointer to the structure that receives a copy of the current statistics.
+		 */
+		void at24cm0x_write_cycle_statistics(AT24CM0X_Write_Cycle_Statistics *statistics)
 		{
-			if(buffer[i] != *(data + i))
-			{
-				return AT24CM0X_Status_Data_Error;
-			}
+			*statistics = at24cm0x_write_cycle_stats;
 		}
 	#endif
 	
-	if(error != TWI_None)
+	static TWI_Error at24cm0x_write_probe(AT24CM0X_Device *device)
 	{
-		return AT24CM0X_Status_TWI_Error;
+		TWI_Error error = TWI_None;
+		
+		at24cm0x_bus_start(TWI_Write);
+		error = twi_address(device->identifier, TWI_Write);
+		at24cm0x_bus_stop();
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_counters.polls++;
+		#endif
+		
+		return error;
 	}
-	return AT24CM0X_Status_Done;
-}
-
+	
+	static AT24CM0X_Status at24cm0x_write_acknowledge_polling(AT24CM0X_Device *device)
+	{
+		unsigned int elapsed = 0;
+		
+		while(at24cm0x_write_probe(device) == TWI_Ack)
+		{
+			if(elapsed >= AT24CM0X_WRITE_TIMEOUT_MS)
+			{
+				return AT24CM0X_Status_Timeout;
+			}
+			at24cm0x_wait_ms(AT24CM0X_WRITE_POLL_INTERVAL_MS);
+			elapsed += AT24CM0X_WRITE_POLL_INTERVAL_MS;
+			
+			#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+				at24cm0x_counters.wait_ms += AT24CM0X_WRITE_POLL_INTERVAL_MS;
+			#endif
+		}
+		
+		#ifdef AT24CM0X_ENABLE_WRITE_CYCLE_STATISTICS
+			at24cm0x_write_cycle_record(elapsed);
+		#endif
+		
+		return AT24CM0X_Status_Done;
+	}
+#endif
+
+static TWI_Error at24cm0x_send_address(AT24CM0X_Device *device, unsigned long address)
+{
+	unsigned char high_byte = (device->identifier | (AT24CM0X_ADDRESS_HIGH_MASK & (unsigned char)(address>>16)));
+	unsigned char middle_byte = (unsigned char)(address>>8);
+	unsigned char low_byte = (unsigned char)(address);
+	
+	TWI_Error error = TWI_None;
+	
+	error |= twi_address(high_byte, TWI_Write);
+	error |= twi_set(middle_byte);
+	error |= twi_set(low_byte);
+	
+	return error;
+}
+
+static TWI_Error at24cm0x_read_select(AT24CM0X_Device *device, unsigned long address)
+{
+	TWI_Error error = TWI_None;
+	
+	#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+		if(device->pointer == address)
+		{
+			at24cm0x_bus_start(TWI_Read);
+			return twi_address(device->identifier, TWI_Read);
+		}
+	#endif
+	
+	at24cm0x_bus_start(TWI_Read);
+	error |= at24cm0x_send_address(device, address);
+	
+	#ifdef AT24CM0X_REPEATED_START
+		#ifdef AT24CM0X_TWI_RESTART_EN
+			twi_restart();
+		#else
+			twi_start();
+		#endif
+	#else
+		twi_stop();
+		twi_start();
+	#endif
+	
+	error |= twi_address(device->identifier, TWI_Read);
+	
+	return error;
+}
+
+#ifndef AT24CM0X_TWI_BUFFER_TRANSFER
+	static TWI_Error at24cm0x_read_transfer(unsigned char *data, unsigned int size, unsigned int *count)
+	{
+		TWI_Error error = TWI_None;
+		unsigned int i = 0;
+		
+		while((i + 1) < size)
+		{
+			error |= twi_get((data + i), TWI_Ack);
+			
+			if(error != TWI_None)
+			{
+				break;
+			}
+			i++;
+		}
+		
+		if(error == TWI_None)
+		{
+			error |= twi_get((data + i), TWI_NACK);
+			
+			if(error == TWI_None)
+			{
+				i++;
+			}
+		}
+		*count = i;
+		
+		return error;
+	}
+#else
+	static TWI_Error at24cm0x_read_transfer(unsigned char *data, unsigned int size, unsigned int *count)
+	{
+		TWI_Error error = twi_buffer_get(data, size);
+		
+		at24cm0x_buffer_wait();
+		
+		error |= twi_buffer_status();
+		*count = (error == TWI_None ? size : 0);
+		
+		return error;
+	}
+#endif
+
+#ifdef AT24CM0X_ENABLE_RETRY
+	static void at24cm0x_recover(AT24CM0X_Device *device)
+	{
+		#ifdef AT24CM0X_ENABLE_OS_HOOKS
+			at24cm0x_os_lock();
+		#endif
+		
+		#ifdef AT24CM0X_TWI_RECOVER_EN
+			twi_recover();
+		#else
+			twi_stop();
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_OS_HOOKS
+			at24cm0x_os_unlock();
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+			device->pointer = AT24CM0X_MEMORY_SIZE;
+		#else
+			(void)device;
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_counters.retries++;
+		#endif
+	}
+#endif
+
+static AT24CM0X_Status at24cm0x_read_block(AT24CM0X_Device *device, unsigned long address, unsigned char *data, unsigned int size)
+{
+	TWI_Error error = TWI_None;
+	unsigned int done = 0;
+	
+	#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+		at24cm0x_trace_begin(AT24CM0X_Trace_Read, device, address, size, at24cm0x_timestamp());
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_RETRY
+		for (unsigned char retry=0; ; retry++)
+		{
+			unsigned int count = 0;
+			
+			error = at24cm0x_read_select(device, (address + done));
+			
+			if(error == TWI_None)
+			{
+				error |= at24cm0x_read_transfer((data + done), (size - done), &count);
+			}
+			at24cm0x_bus_stop();
+			
+			done += count;
+			
+			if(error == TWI_None || retry >= AT24CM0X_RETRIES)
+			{
+				break;
+			}
+			at24cm0x_recover(device);
+		}
+	#else
+		error |= at24cm0x_read_select(device, address);
+		
+		if(error == TWI_None)
+		{
+			error |= at24cm0x_read_transfer(data, size, &done);
+		}
+		at24cm0x_bus_stop();
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+		at24cm0x_pointer_read(device, address, size, (error == TWI_None));
+	#endif
+	
+	AT24CM0X_Status status = (error == TWI_None ? AT24CM0X_Status_Done : AT24CM0X_Status_TWI_Error);
+	
+	#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+		at24cm0x_counters.read_bytes += done;
+		at24cm0x_instrument_error(error);
+		at24cm0x_trace_end(AT24CM0X_Trace_Read, device, status, at24cm0x_timestamp());
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+		at24cm0x_speed_update(error);
+	#endif
+	
+	return status;
+}
+
+#ifdef AT24CM0X_ENABLE_READ_CACHE
+	static void at24cm0x_read_cache_update(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, unsigned int size)
+	{
+		for (unsigned char i=0; i < AT24CM0X_READ_CACHE_LINES; i++)
+		{
+			unsigned long base = at24cm0x_read_cache[i].tag * AT24CM0X_READ_CACHE_LINE_SIZE;
+			
+			if(!at24cm0x_read_cache[i].valid || at24cm0x_read_cache[i].device != device || (base + AT24CM0X_READ_CACHE_LINE_SIZE) <= address || base >= (address + size))
+			{
+				continue;
+			}
+			
+			if(!data)
+			{
+				at24cm0x_read_cache[i].valid = 0;
+				continue;
+			}
+			
+			for (unsigned int j=0; j < AT24CM0X_READ_CACHE_LINE_SIZE; j++)
+			{
+				if((base + j) >= address && (base + j) < (address + size))
+				{
+					at24cm0x_read_cache[i].data[j] = *(data + (base + j - address));
+				}
+			}
+		}
+	}
+	
+	static AT24CM0X_Status at24cm0x_read_cache_read(AT24CM0X_Device *device, unsigned long address, unsigned char *data, unsigned int size)
+	{
+		if(size > AT24CM0X_READ_CACHE_LINE_SIZE)
+		{
+			return at24cm0x_read_block(device, address, data, size);
+		}
+		
+		while(size > 0)
+		{
+			unsigned long tag = address / AT24CM0X_READ_CACHE_LINE_SIZE;
+			unsigned char line = (unsigned char)(tag % AT24CM0X_READ_CACHE_LINES);
+			unsigned int offset = (unsigned int)(address % AT24CM0X_READ_CACHE_LINE_SIZE);
+			unsigned int chunk = AT24CM0X_READ_CACHE_LINE_SIZE - offset;
+			
+			if(chunk > size)
+			{
+				chunk = size;
+			}
+			
+			if(at24cm0x_read_cache[line].valid && at24cm0x_read_cache[line].device == device && at24cm0x_read_cache[line].tag == tag)
+			{
+				at24cm0x_read_cache_hits++;
+			}
+			else
+			{
+				at24cm0x_read_cache_misses++;
+				at24cm0x_read_cache[line].valid = 0;
+				
+				AT24CM0X_Status status = at24cm0x_read_block(device, tag * AT24CM0X_READ_CACHE_LINE_SIZE, at24cm0x_read_cache[line].data, AT24CM0X_READ_CACHE_LINE_SIZE);
+				
+				if(status != AT24CM0X_Status_Done)
+				{
+					return status;
+				}
+				at24cm0x_read_cache[line].device = device;
+				at24cm0x_read_cache[line].tag = tag;
+				at24cm0x_read_cache[line].valid = 1;
+			}
+			
+			for (unsigned int i=0; i < chunk; i++)
+			{
+				*(data + i) = at24cm0x_read_cache[line].data[offset + i];
+			}
+			address += chunk;
+			data += chunk;
+			size -= chunk;
+		}
+		return AT24CM0X_Status_Done;
+	}
+	
+	/**
+	 * @brief Returns the hit and miss counters of the read cache.
+	 * 
+	 * @details
+	 * The counters are incremented for every cache line lookup of @ref at24cm0x_read_byte and @ref at24cm0x_read_sequential (see @ref AT24CM0X_ENABLE_READ_CACHE) and are cleared by @ref at24cm0x_init. Reads larger than @ref AT24CM0X_READ_CACHE_LINE_SIZE bypass the cache and are not counted. The ratio of both values can be used to size @ref AT24CM0X_READ_CACHE_LINES and @ref AT24CM0X_READ_CACHE_LINE_SIZE.
+	 * 
+	 * @param hits   Pointer where the number of cache hits will be stored.
+	 * @param misses Pointer where the number of cache misses will be stored.
+	 */
+	void at24cm0x_read_cache_statistics(unsigned long *hits, unsigned long *misses)
+	{
+		*hits = at24cm0x_read_cache_hits;
+		*misses = at24cm0x_read_cache_misses;
+	}
+#endif
+
+#ifdef AT24CM0X_ENABLE_READ_AHEAD
+	static void at24cm0x_read_ahead_update(AT24CM0X_Device *device, unsigned long address, unsigned int size)
+	{
+		if(at24cm0x_read_ahead.device == device && address < (at24cm0x_read_ahead.address + at24cm0x_read_ahead.size) && (address + size) > at24cm0x_read_ahead.address)
+		{
+			at24cm0x_read_ahead.size = 0;
+		}
+	}
+	
+	static AT24CM0X_Status at24cm0x_read_ahead_read(AT24CM0X_Device *device, unsigned long address, unsigned char *data, unsigned int size)
+	{
+		unsigned char sequential = (at24cm0x_read_ahead.device == device && at24cm0x_read_ahead.next == address);
+		
+		at24cm0x_read_ahead.next = address + size;
+		
+		if(at24cm0x_read_ahead.device != device || address < at24cm0x_read_ahead.address || (address + size) > (at24cm0x_read_ahead.address + at24cm0x_read_ahead.size))
+		{
+			if(at24cm0x_read_ahead.device != device)
+			{
+				at24cm0x_read_ahead.device = device;
+				at24cm0x_read_ahead.size = 0;
+			}
+			
+			unsigned int window = AT24CM0X_READ_AHEAD_SIZE;
+			
+			if(window > (device->size - address))
+			{
+				window = (unsigned int)(device->size - address);
+			}
+			
+			if(!sequential || size > window)
+			{
+				return at24cm0x_read_block(device, address, data, size);
+			}
+			at24cm0x_read_ahead.size = 0;
+			
+			AT24CM0X_Status status = at24cm0x_read_block(device, address, at24cm0x_read_ahead.data, window);
+			
+			if(status != AT24CM0X_Status_Done)
+			{
+				return status;
+			}
+			at24cm0x_read_ahead.address = address;
+			at24cm0x_read_ahead.size = window;
+		}
+		
+		for (unsigned int i=0; i < size; i++)
+		{
+			*(data + i) = at24cm0x_read_ahead.data[address - at24cm0x_read_ahead.address + i];
+		}
+		return AT24CM0X_Status_Done;
+	}
+#endif
+
+static TWI_Error at24cm0x_write_data(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, unsigned int size)
+{
+	TWI_Error error = TWI_None;
+	
+	#ifdef AT24CM0X_TWI_BUFFER_TRANSFER
+		error |= twi_buffer_set(data, size);
+		
+		at24cm0x_buffer_wait();
+		
+		error |= twi_buffer_status();
+	#else
+		for (unsigned int i=0; i < size && error == TWI_None; i++)
+		{
+			error |= twi_set(*(data + i));
+		}
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_READ_CACHE
+		at24cm0x_read_cache_update(device, address, (error == TWI_None ? data : 0), size);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_READ_AHEAD
+		at24cm0x_read_ahead_update(device, address, size);
+	#endif
+	
+	#if !defined(AT24CM0X_ENABLE_READ_CACHE) && !defined(AT24CM0X_ENABLE_READ_AHEAD)
+		(void)device;
+		(void)address;
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+		at24cm0x_counters.written_bytes += size;
+	#endif
+	
+	return error;
+}
+
+static TWI_Error at24cm0x_write_transfer(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, unsigned int size)
+{
+	TWI_Error error = TWI_None;
+	
+	at24cm0x_bus_start(TWI_Write);
+	error |= at24cm0x_send_address(device, address);
+	
+	if(error == TWI_None)
+	{
+		error |= at24cm0x_write_data(device, address, data, size);
+	}
+	at24cm0x_bus_stop();
+	
+	#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+		at24cm0x_pointer_write(device, address, size, (error == TWI_None));
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+		at24cm0x_counters.write_cycles++;
+		at24cm0x_instrument_error(error);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+		at24cm0x_speed_update(error);
+	#endif
+	
+	return error;
+}
+
+static AT24CM0X_Status at24cm0x_write_cycle(AT24CM0X_Device *device)
+{
+	#ifdef AT24CM0X_WRITE_ACKNOWLEDGE_POLLING
+		return at24cm0x_write_acknowledge_polling(device);
+	#else
+		(void)device;
+		
+		at24cm0x_wait_ms(AT24CM0X_WRITE_CYCLE_MS);
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_counters.wait_ms += AT24CM0X_WRITE_CYCLE_MS;
+		#endif
+		
+		return AT24CM0X_Status_Done;
+	#endif
+}
+
+/**
+ * @brief Calculates a CRC16 over a block of data.
+ * 
+ * @details
+ * This function updates the given CRC with @p size bytes using the CRC16-CCITT polynomial `0x1021` (MSB first, no final XOR). The calculation is done bit-wise and needs no lookup table. To start a new CRC, pass `0xFFFF` as initial value; blocks can be chained by passing the result of the previous call. The function is used by the integrity check (@ref AT24CM0X_INTEGRITY_CRC) and can be used by the application to protect data stored in the EEPROM.
+ * 
+ * @param crc  Initial or previous CRC value.
+ * @param data Pointer to the data over which the CRC is calculated.
+ * @param size Number of bytes in the data block.
+ * 
+ * @return unsigned int Updated 16-bit CRC value.
+ */
+unsigned int at24cm0x_crc16(unsigned int crc, const unsigned char *data, unsigned int size)
+{
+	for (unsigned int i=0; i < size; i++)
+	{
+		crc ^= ((unsigned int)*(data + i))<<8;
+		
+		for (unsigned char j=0; j < 8; j++)
+		{
+			if(crc & 0x8000)
+			{
+				crc = (crc<<1) ^ 0x1021;
+			}
+			else
+			{
+				crc <<= 1;
+			}
+		}
+		crc &= 0xFFFF;
+	}
+	return crc;
+}
+
+#ifdef AT24CM0X_ENABLE_INTEGRITY_CHECK
+	static AT24CM0X_Status at24cm0x_verify(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, unsigned int size)
+	{
+		AT24CM0X_Status status = AT24CM0X_Status_Done;
+		TWI_Error error = at24cm0x_read_select(device, address);
+		
+		#ifdef AT24CM0X_INTEGRITY_CRC
+			unsigned int crc = 0xFFFF;
+		#endif
+		
+		unsigned int count = 0;
+		
+		while(count < size && status == AT24CM0X_Status_Done && error == TWI_None)
+		{
+			unsigned char value = 0;
+			TWI_Operation ack = TWI_Ack;
+			
+			if(count >= (size - 1))
+			{
+				ack = TWI_NACK;
+			}
+			error |= twi_get(&value, ack);
+			
+			#ifdef AT24CM0X_INTEGRITY_CRC
+				crc = at24cm0x_crc16(crc, &value, 1);
+			#else
+				if(value != *(data + count))
+				{
+					status = AT24CM0X_Status_Data_Error;
+					
+					if(ack == TWI_Ack)
+					{
+						error |= twi_get(&value, TWI_NACK);
+						count++;
+					}
+				}
+			#endif
+			count++;
+		}
+		at24cm0x_bus_stop();
+		
+		#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+			at24cm0x_pointer_read(device, address, count, (error == TWI_None));
+		#endif
+		
+		#ifdef AT24CM0X_INTEGRITY_CRC
+			if(crc != at24cm0x_crc16(0xFFFF, data, size))
+			{
+				status = AT24CM0X_Status_Data_Error;
+			}
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_counters.read_bytes += count;
+			at24cm0x_instrument_error(error);
+			
+			if(error == TWI_None && status == AT24CM0X_Status_Data_Error)
+			{
+				at24cm0x_counters.integrity_errors++;
+			}
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+			at24cm0x_speed_update(error);
+		#endif
+		
+		if(error != TWI_None)
+		{
+			return AT24CM0X_Status_TWI_Error;
+		}
+		return status;
+	}
+#endif
+
+#if defined(AT24CM0X_ENABLE_CONDITIONAL_WRITE) || defined(AT24CM0X_ENABLE_IMAGE)
+	static TWI_Error at24cm0x_compare(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, unsigned int size, unsigned int *first, unsigned int *last)
+	{
+		TWI_Error error = at24cm0x_read_select(device, address);
+		
+		*first = size;
+		*last = 0;
+		
+		for (unsigned int i=0; i < size && error == TWI_None; i++)
+		{
+			unsigned char value = 0;
+			TWI_Operation ack = TWI_Ack;
+			
+			if(i >= (size - 1))
+			{
+				ack = TWI_NACK;
+			}
+			error |= twi_get(&value, ack);
+			
+			if(value != *(data + i))
+			{
+				if(*first == size)
+				{
+					*first = i;
+				}
+				*last = i + 1;
+			}
+		}
+		at24cm0x_bus_stop();
+		
+		#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+			at24cm0x_pointer_read(device, address, size, (error == TWI_None));
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_counters.read_bytes += size;
+			at24cm0x_instrument_error(error);
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+			at24cm0x_speed_update(error);
+		#endif
+		
+		return error;
+	}
+#endif
+
+#ifdef AT24CM0X_ENABLE_CONDITIONAL_WRITE
+	/**
+	 * @brief Returns the savings of the conditional write mode.
+	 * 
+	 * @details
+	 * The counters are updated by every blocking page write when @ref AT24CM0X_ENABLE_CONDITIONAL_WRITE is defined and are cleared by @ref at24cm0x_init. A skipped write cycle means that a page write was not issued at all because the page already contained the data.
+	 * 
+	 * @param bytes  Pointer where the number of bytes that were not programmed will be stored.
+	 * @param cycles Pointer where the number of skipped write cycles will be stored.
+	 */
+	void at24cm0x_conditional_statistics(unsigned long *bytes, unsigned long *cycles)
+	{
+		*bytes = at24cm0x_skipped_bytes;
+		*cycles = at24cm0x_skipped_cycles;
+	}
+#endif
+
+static AT24CM0X_Status at24cm0x_program_block(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, unsigned int size)
+{
+	TWI_Error error = TWI_None;
+	
+	#ifdef AT24CM0X_ENABLE_CONDITIONAL_WRITE
+		unsigned int first = 0;
+		unsigned int last = 0;
+		
+		if(at24cm0x_compare(device, address, data, size, &first, &last) != TWI_None)
+		{
+			return AT24CM0X_Status_TWI_Error;
+		}
+		if(first == size)
+		{
+			at24cm0x_skipped_bytes += size;
+			at24cm0x_skipped_cycles++;
+			
+			return AT24CM0X_Status_Done;
+		}
+		at24cm0x_skipped_bytes += size - (last - first);
+		
+		address += first;
+		data += first;
+		size = last - first;
+	#endif
+	
+	#ifdef AT24CM0X_WP_CONTROL_EN
+		at24cm0x_wp(AT24CM0X_WP_Mode_Disabled);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_RETRY
+		AT24CM0X_Status status = AT24CM0X_Status_Done;
+		
+		for (unsigned char retry=0; ; retry++)
+		{
+			error = at24cm0x_write_transfer(device, address, data, size);
+			
+			if(error != TWI_None && retry < AT24CM0X_RETRIES)
+			{
+				at24cm0x_recover(device);
+			}
+			status = at24cm0x_write_cycle(device);
+			
+			if(error == TWI_None || status != AT24CM0X_Status_Done || retry >= AT24CM0X_RETRIES)
+			{
+				break;
+			}
+		}
+	#else
+		error |= at24cm0x_write_transfer(device, address, data, size);
+		
+		AT24CM0X_Status status = at24cm0x_write_cycle(device);
+	#endif
+	
+	#ifdef AT24CM0X_WP_CONTROL_EN
+		at24cm0x_wp(AT24CM0X_WP_Mode_Enabled);
+	#endif
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		return status;
+	}
+	
+	#ifdef AT24CM0X_ENABLE_INTEGRITY_CHECK
+		status = at24cm0x_verify(device, address, data, size);
+		
+		if(status != AT24CM0X_Status_Done)
+		{
+			return status;
+		}
+	#endif
+	
+	if(error != TWI_None)
+	{
+		return AT24CM0X_Status_TWI_Error;
+	}
+	return AT24CM0X_Status_Done;
+}
+
+static AT24CM0X_Status at24cm0x_write_block(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, unsigned int size)
+{
+	#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+		at24cm0x_trace_begin(AT24CM0X_Trace_Write, device, address, size, at24cm0x_timestamp());
+	#endif
+	
+	AT24CM0X_Status status = at24cm0x_program_block(device, address, data, size);
+	
+	#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+		at24cm0x_trace_end(AT24CM0X_Trace_Write, device, status, at24cm0x_timestamp());
+	#endif
+	
+	return status;
+}
+
+static AT24CM0X_Status at24cm0x_check_range(AT24CM0X_Device *device, unsigned long address, unsigned long size)
+{
+	if(address >= device->size)
+	{
+		return AT24CM0X_Status_Address_Error;
+	}
+	
+	if(size == 0 || size > (device->size - address))
+	{
+		return AT24CM0X_Status_Size_Error;
+	}
+	return AT24CM0X_Status_Done;
+}
+
+static unsigned int at24cm0x_chunk(unsigned long address, unsigned long size)
+{
+	unsigned int chunk = (unsigned int)(AT24CM0X_PAGE_SIZE - (address & AT24CM0X_PAGE_MASK));
+	
+	if(chunk > size)
+	{
+		chunk = (unsigned int)size;
+	}
+	return chunk;
+}
+
+#ifdef AT24CM0X_ENABLE_WRITE_CACHE
+	static struct
+	{
+		AT24CM0X_Device *device;
+		unsigned int page;
+		unsigned int start;
+		unsigned int end;
+		unsigned int used;
+		unsigned char dirty;
+		unsigned char data[AT24CM0X_PAGE_SIZE];
+	} at24cm0x_cache[AT24CM0X_WRITE_CACHE_LINES];
+	
+	static unsigned int at24cm0x_cache_clock;
+	
+	static unsigned char at24cm0x_cache_find(AT24CM0X_Device *device, unsigned int page)
+	{
+		for (unsigned char i=0; i < AT24CM0X_WRITE_CACHE_LINES; i++)
+		{
+			if(at24cm0x_cache[i].end != 0 && at24cm0x_cache[i].device == device && at24cm0x_cache[i].page == page)
+			{
+				return i;
+			}
+		}
+		return AT24CM0X_WRITE_CACHE_LINES;
+	}
+	
+	static AT24CM0X_Status at24cm0x_cache_flush_line(unsigned char line)
+	{
+		if(!at24cm0x_cache[line].dirty)
+		{
+			return AT24CM0X_Status_Done;
+		}
+		
+		unsigned long address = ((unsigned long)at24cm0x_cache[line].page << AT24CM0X_PAGE_SHIFT) + at24cm0x_cache[line].start;
+		AT24CM0X_Status status = at24cm0x_write_block(at24cm0x_cache[line].device, address, &at24cm0x_cache[line].data[at24cm0x_cache[line].start], at24cm0x_cache[line].end - at24cm0x_cache[line].start);
+		
+		if(status == AT24CM0X_Status_Done)
+		{
+			at24cm0x_cache[line].dirty = 0;
+		}
+		return status;
+	}
+	
+	static AT24CM0X_Status at24cm0x_cache_write(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, unsigned int size)
+	{
+		AT24CM0X_Status status = AT24CM0X_Status_Done;
+		
+		unsigned int page = (unsigned int)(address >> AT24CM0X_PAGE_SHIFT);
+		unsigned int start = (unsigned int)(address & AT24CM0X_PAGE_MASK);
+		unsigned int end = start + size;
+		unsigned long base = address - start;
+		
+		unsigned char line = at24cm0x_cache_find(device, page);
+		
+		if(line == AT24CM0X_WRITE_CACHE_LINES)
+		{
+			if(size == AT24CM0X_PAGE_SIZE)
+			{
+				return at24cm0x_write_block(device, address, data, size);
+			}
+			line = 0;
+			
+			for (unsigned char i=1; i < AT24CM0X_WRITE_CACHE_LINES; i++)
+			{
+				if(at24cm0x_cache[i].end == 0 || (at24cm0x_cache[line].end != 0 && at24cm0x_cache[i].used < at24cm0x_cache[line].used))
+				{
+					line = i;
+				}
+			}
+			status = at24cm0x_cache_flush_line(line);
+			
+			if(status != AT24CM0X_Status_Done)
+			{
+				return status;
+			}
+			at24cm0x_cache[line].device = device;
+			at24cm0x_cache[line].page = page;
+			at24cm0x_cache[line].start = start;
+			at24cm0x_cache[line].end = end;
+		}
+		else
+		{
+			if(start > at24cm0x_cache[line].end)
+			{
+				status = at24cm0x_read_block(device, base + at24cm0x_cache[line].end, &at24cm0x_cache[line].data[at24cm0x_cache[line].end], start - at24cm0x_cache[line].end);
+			}
+			else if(end < at24cm0x_cache[line].start)
+			{
+				status = at24cm0x_read_block(device, base + end, &at24cm0x_cache[line].data[end], at24cm0x_cache[line].start - end);
+			}
+			
+			if(status != AT24CM0X_Status_Done)
+			{
+				return status;
+			}
+			
+			if(start < at24cm0x_cache[line].start)
+			{
+				at24cm0x_cache[line].start = start;
+			}
+			
+			if(end > at24cm0x_cache[line].end)
+			{
+				at24cm0x_cache[line].end = end;
+			}
+		}
+		
+		for (unsigned int i=0; i < size; i++)
+		{
+			at24cm0x_cache[line].data[start + i] = *(data + i);
+		}
+		at24cm0x_cache[line].dirty = 1;
+		at24cm0x_cache[line].used = ++at24cm0x_cache_clock;
+		
+		return AT24CM0X_Status_Done;
+	}
+	
+	static void at24cm0x_cache_overlay(AT24CM0X_Device *device, unsigned long address, unsigned char *data, unsigned int size)
+	{
+		for (unsigned char i=0; i < AT24CM0X_WRITE_CACHE_LINES; i++)
+		{
+			if(at24cm0x_cache[i].end == 0 || at24cm0x_cache[i].device != device)
+			{
+				continue;
+			}
+			
+			unsigned long base = ((unsigned long)at24cm0x_cache[i].page << AT24CM0X_PAGE_SHIFT);
+			unsigned long start = base + at24cm0x_cache[i].start;
+			unsigned long end = base + at24cm0x_cache[i].end;
+			
+			if(start < address)
+			{
+				start = address;
+			}
+			
+			if(end > (address + size))
+			{
+				end = address + size;
+			}
+			
+			for (unsigned long position = start; position < end; position++)
+			{
+				*(data + (position - address)) = at24cm0x_cache[i].data[position - base];
+			}
+		}
+	}
+	
+	static unsigned char at24cm0x_cache_read(AT24CM0X_Device *device, unsigned long address, unsigned char *data, unsigned int size)
+	{
+		unsigned long position = address;
+		unsigned long remaining = size;
+		
+		while(remaining > 0)
+		{
+			unsigned int chunk = at24cm0x_chunk(position, remaining);
+			unsigned int start = (unsigned int)(position & AT24CM0X_PAGE_MASK);
+			unsigned char line = at24cm0x_cache_find(device, (unsigned int)(position >> AT24CM0X_PAGE_SHIFT));
+			
+			if(line == AT24CM0X_WRITE_CACHE_LINES || start < at24cm0x_cache[line].start || (start + chunk) > at24cm0x_cache[line].end)
+			{
+				return 0;
+			}
+			position += chunk;
+			remaining -= chunk;
+		}
+		at24cm0x_cache_overlay(device, address, data, size);
+		
+		return 1;
+	}
+	
+	static AT24CM0X_Status at24cm0x_cache_sync(AT24CM0X_Device *device, unsigned long address, unsigned long size, unsigned char drop)
+	{
+		for (unsigned char i=0; i < AT24CM0X_WRITE_CACHE_LINES; i++)
+		{
+			unsigned long base = ((unsigned long)at24cm0x_cache[i].page << AT24CM0X_PAGE_SHIFT);
+			
+			if(at24cm0x_cache[i].end == 0 || at24cm0x_cache[i].device != device || (base + AT24CM0X_PAGE_SIZE) <= address || base >= (address + size))
+			{
+				continue;
+			}
+			
+			AT24CM0X_Status status = at24cm0x_cache_flush_line(i);
+			
+			if(status != AT24CM0X_Status_Done)
+			{
+				return status;
+			}
+			
+			if(drop)
+			{
+				at24cm0x_cache[i].start = 0;
+				at24cm0x_cache[i].end = 0;
+			}
+		}
+		return AT24CM0X_Status_Done;
+	}
+	
+	/**
+	 * @brief Writes all dirty lines of the write-back cache to the AT24CM0X EEPROM.
+	 * 
+	 * @details
+	 * This function rewrites the dirty byte range of every cache line with a single page write (see @ref AT24CM0X_ENABLE_WRITE_CACHE). Lines are flushed in index order; a line whose write fails stays dirty so that it is retried with the next flush. The cached data remains available for reads after flushing.
+	 * 
+	 * @note Call this function before power down or whenever the data has to be persistent, because cached updates are lost on reset.
+	 * 
+	 * @return AT24CM0X_Status Status of the first failing page write, or @ref AT24CM0X_Status_Done if all lines were written.
+	 */
+	AT24CM0X_Status at24cm0x_flush(void)
+	{
+		AT24CM0X_Status status = AT24CM0X_Status_Done;
+		
+		for (unsigned char i=0; i < AT24CM0X_WRITE_CACHE_LINES; i++)
+		{
+			AT24CM0X_Status line_status = at24cm0x_cache_flush_line(i);
+			
+			if(status == AT24CM0X_Status_Done)
+			{
+				status = line_status;
+			}
+		}
+		return status;
+	}
+#endif
+
+#ifdef AT24CM0X_ENABLE_WRITE_QUEUE
+	static AT24CM0X_Status at24cm0x_queue_sync(AT24CM0X_Device *device, unsigned long address, unsigned long size)
+	{
+		AT24CM0X_Status status = AT24CM0X_Status_Done;
+		unsigned char count = 0;
+		
+		for (unsigned char i=0; i < at24cm0x_queue_count; i++)
+		{
+			if(status == AT24CM0X_Status_Done && (device == 0 || (at24cm0x_queue[i].device == device && at24cm0x_queue[i].address < (address + size) && (at24cm0x_queue[i].address + at24cm0x_queue[i].size) > address)))
+			{
+				status = at24cm0x_write_block(at24cm0x_queue[i].device, at24cm0x_queue[i].address, at24cm0x_queue[i].data, at24cm0x_queue[i].size);
+				
+				if(status == AT24CM0X_Status_Done)
+				{
+					continue;
+				}
+			}
+			
+			if(count != i)
+			{
+				at24cm0x_queue[count] = at24cm0x_queue[i];
+			}
+			count++;
+		}
+		
+		if(count != at24cm0x_queue_count)
+		{
+			at24cm0x_queue_count = count;
+			at24cm0x_queue_timestamp = at24cm0x_timestamp();
+		}
+		return status;
+	}
+	
+	static AT24CM0X_Status at24cm0x_queue_write(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, unsigned int size)
+	{
+		if(size > AT24CM0X_WRITE_QUEUE_SPAN_SIZE)
+		{
+			AT24CM0X_Status status = at24cm0x_queue_sync(device, address, size);
+			
+			if(status != AT24CM0X_Status_Done)
+			{
+				return status;
+			}
+			return at24cm0x_write_block(device, address, data, size);
+		}
+		
+		unsigned long base = address & ~AT24CM0X_PAGE_MASK;
+		unsigned long end = address + size;
+		unsigned char entry = at24cm0x_queue_count;
+		
+		for (unsigned char i=0; i < at24cm0x_queue_count; i++)
+		{
+			if(at24cm0x_queue[i].device != device)
+			{
+				continue;
+			}
+			
+			unsigned long start = at24cm0x_queue[i].address;
+			unsigned long stop = start + at24cm0x_queue[i].size;
+			
+			for (unsigned long position = (start > address ? start : address); position < (stop < end ? stop : end); position++)
+			{
+				at24cm0x_queue[i].data[position - start] = *(data + (position - address));
+			}
+			
+			unsigned long first = (start < address ? start : address);
+			unsigned long last = (stop > end ? stop : end);
+			
+			if(entry == at24cm0x_queue_count && (start & ~AT24CM0X_PAGE_MASK) == base && start <= end && stop >= address && (last - first) <= AT24CM0X_WRITE_QUEUE_SPAN_SIZE)
+			{
+				entry = i;
+			}
+		}
+		
+		if(entry == at24cm0x_queue_count)
+		{
+			if(at24cm0x_queue_count == AT24CM0X_WRITE_QUEUE_ENTRIES)
+			{
+				AT24CM0X_Status status = at24cm0x_queue_sync(0, 0, 0);
+				
+				if(status != AT24CM0X_Status_Done)
+				{
+					return status;
+				}
+				entry = at24cm0x_queue_count;
+			}
+			
+			if(at24cm0x_queue_count == 0)
+			{
+				at24cm0x_queue_timestamp = at24cm0x_timestamp();
+			}
+			at24cm0x_queue[entry].device = device;
+			at24cm0x_queue[entry].address = address;
+			at24cm0x_queue[entry].size = 0;
+			at24cm0x_queue_count++;
+		}
+		
+		unsigned long start = at24cm0x_queue[entry].address;
+		
+		if(address < start)
+		{
+			unsigned int shift = (unsigned int)(start - address);
+			
+			for (unsigned int i=at24cm0x_queue[entry].size; i > 0; i--)
+			{
+				at24cm0x_queue[entry].data[(i - 1) + shift] = at24cm0x_queue[entry].data[i - 1];
+			}
+			at24cm0x_queue[entry].address = address;
+			at24cm0x_queue[entry].size += shift;
+			start = address;
+		}
+		
+		for (unsigned int i=0; i < size; i++)
+		{
+			at24cm0x_queue[entry].data[(address - start) + i] = *(data + i);
+		}
+		
+		if((end - start) > at24cm0x_queue[entry].size)
+		{
+			at24cm0x_queue[entry].size = (unsigned int)(end - start);
+		}
+		
+		if(at24cm0x_queue_count >= AT24CM0X_WRITE_QUEUE_THRESHOLD)
+		{
+			return at24cm0x_queue_sync(0, 0, 0);
+		}
+		return at24cm0x_write_queue_task();
+	}
+	
+	static void at24cm0x_queue_overlay(AT24CM0X_Device *device, unsigned long address, unsigned char *data, unsigned int size)
+	{
+		for (unsigned char i=0; i < at24cm0x_queue_count; i++)
+		{
+			if(at24cm0x_queue[i].device != device)
+			{
+				continue;
+			}
+			
+			unsigned long start = at24cm0x_queue[i].address;
+			unsigned long end = start + at24cm0x_queue[i].size;
+			
+			for (unsigned long position = (start > address ? start : address); position < (end < (address + size) ? end : (address + size)); position++)
+			{
+				*(data + (position - address)) = at24cm0x_queue[i].data[position - start];
+			}
+		}
+	}
+	
+	/**
+	 * @brief Writes all pending spans of the write coalescing queue to the AT24CM0X EEPROM.
+	 * 
+	 * @details
+	 * This function programs every pending span with a single page write (see @ref AT24CM0X_ENABLE_WRITE_QUEUE) in the order the spans were queued. A span whose write fails stays in the queue so that it is retried with the next flush.
+	 * 
+	 * @note Call this function before power down or whenever the data has to be persistent, because pending spans are lost on reset.
+	 * 
+	 * @return AT24CM0X_Status Status of the first failing page write, or @ref AT24CM0X_Status_Done if all spans were written.
+	 */
+	AT24CM0X_Status at24cm0x_write_queue_flush(void)
+	{
+		return at24cm0x_queue_sync(0, 0, 0);
+	}
+	
+	/**
+	 * @brief Drains the write coalescing queue when its deadline has expired.
+	 * 
+	 * @details
+	 * This function compares the age of the oldest pending span against @ref AT24CM0X_WRITE_QUEUE_DEADLINE_MS using @ref at24cm0x_timestamp and calls @ref at24cm0x_write_queue_flush once it is exceeded. It should be called periodically (e.g. from the main loop), so that pending data is written even if no further writes are issued.
+	 * 
+	 * @return AT24CM0X_Status @ref AT24CM0X_Status_Done if the deadline has not expired yet, otherwise the status of the flush.
+	 */
+	AT24CM0X_Status at24cm0x_write_queue_task(void)
+	{
+		if(at24cm0x_queue_count == 0 || (at24cm0x_timestamp() - at24cm0x_queue_timestamp) < AT24CM0X_WRITE_QUEUE_DEADLINE_MS)
+		{
+			return AT24CM0X_Status_Done;
+		}
+		return at24cm0x_queue_sync(0, 0, 0);
+	}
+#endif
+
+static AT24CM0X_Status at24cm0x_write_chunk(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, unsigned int size)
+{
+	#if defined(AT24CM0X_ENABLE_WRITE_CACHE)
+		return at24cm0x_cache_write(device, address, data, size);
+	#elif defined(AT24CM0X_ENABLE_WRITE_QUEUE)
+		return at24cm0x_queue_write(device, address, data, size);
+	#else
+		return at24cm0x_write_block(device, address, data, size);
+	#endif
+}
+
+static AT24CM0X_Status at24cm0x_read_chunk(AT24CM0X_Device *device, unsigned long address, unsigned char *data, unsigned int size)
+{
+	#ifdef AT24CM0X_ENABLE_WRITE_CACHE
+		if(at24cm0x_cache_read(device, address, data, size))
+		{
+			return AT24CM0X_Status_Done;
+		}
+	#endif
+	
+	#if defined(AT24CM0X_ENABLE_READ_CACHE)
+		AT24CM0X_Status status = at24cm0x_read_cache_read(device, address, data, size);
+	#elif defined(AT24CM0X_ENABLE_READ_AHEAD)
+		AT24CM0X_Status status = at24cm0x_read_ahead_read(device, address, data, size);
+	#else
+		AT24CM0X_Status status = at24cm0x_read_block(device, address, data, size);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_WRITE_CACHE
+		at24cm0x_cache_overlay(device, address, data, size);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_WRITE_QUEUE
+		at24cm0x_queue_overlay(device, address, data, size);
+	#endif
+	
+	return status;
+}
+
+/**
+ * @brief Writes a single byte to the AT24CM0X EEPROM.
+ * 
+ * @details
+ * This function writes one byte of data to the specified EEPROM address of the AT24CM0X device. It first checks whether the given address is within the valid memory range defined by @ref AT24CM0X_MEMORY_SIZE; if not, it returns @ref AT24CM0X_Status_Address_Error. If write-protect control is enabled (@ref AT24CM0X_WP_CONTROL_EN), the function temporarily disables write-protect before issuing the write and re-enables it afterward. The write operation itself is performed using the TWI/I2C interface: a start condition is sent, the device/address sequence is transmitted via @ref at24cm0x_send_address, the data byte is written, and a stop condition is generated.
+ * 
+ * After the write, the function either performs write acknowledge polling (@ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING) or waits for a fixed write cycle time (@ref AT24CM0X_WRITE_CYCLE_MS), depending on the compile-time configuration. If the device does not acknowledge within @ref AT24CM0X_WRITE_TIMEOUT_MS, it returns @ref AT24CM0X_Status_Timeout. If any TWI communication error occurs, it returns @ref AT24CM0X_Status_TWI_Error.
+ * 
+ * When integrity checking is enabled (@ref AT24CM0X_ENABLE_INTEGRITY_CHECK), the function reads back the byte and compares it with the original value; if they do not match, it returns @ref AT24CM0X_Status_Data_Error. On success, the function returns @ref AT24CM0X_Status_Done.
+ * 
+ * With @ref AT24CM0X_ENABLE_WRITE_CACHE the byte is merged into the write-back cache instead and is written to the device on @ref at24cm0x_flush or when its cache line is evicted.
+ * 
+ * With @ref AT24CM0X_ENABLE_WRITE_QUEUE the byte is merged into a pending span of the write coalescing queue and is written when the queue is drained.
+ * 
+ * @param address EEPROM memory address at which the byte will be written.
+ * @param data    Data byte to write to the specified address.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_write_byte(unsigned long address, unsigned char data)
+{
+	return at24cm0x_device_write_byte(at24cm0x_active, address, data);
+}
+
+/**
+ * @brief Writes a single byte to the given AT24CM0X device.
+ * 
+ * @details
+ * Handle based version of @ref at24cm0x_write_byte. The address is checked against the size of the handle.
+ * 
+ * @param device  Pointer to a handle initialized with @ref at24cm0x_device_init.
+ * @param address EEPROM memory address at which the byte will be written.
+ * @param data    Data byte to write to the specified address.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_device_write_byte(AT24CM0X_Device *device, unsigned long address, unsigned char data)
+{
+	if(address >= device->size)
+	{
+		return AT24CM0X_Status_Address_Error;
+	}
+	return at24cm0x_write_chunk(device, address, &data, 1);
+}
+
+/**
+ * @brief Writes a sequence of bytes to a single EEPROM page.
+ * 
+ * @details
+ * This function writes a contiguous block of data to one page of the AT24CM0X EEPROM, starting at the first byte of the page. It first validates the page index against @ref AT24CM0X_PAGES and the data length against @ref AT24CM0X_PAGE_SIZE; if the page is out of range, it returns @ref AT24CM0X_Status_Page_Error, and if the size is zero or larger than the page size, it returns @ref AT24CM0X_Status_Size_Error. A full page of @ref AT24CM0X_PAGE_SIZE bytes is programmed with a single write cycle.
+ * 
+ * The target EEPROM address is calculated from the page index and @ref AT24CM0X_PAGE_SIZE. If write-protect control is enabled (@ref AT24CM0X_WP_CONTROL_EN), write-protect is temporarily disabled before the TWI/I2C transfer and re-enabled afterward. The function then issues a start condition, sends the device/address sequence via @ref at24cm0x_send_address, and transmits each byte from the provided buffer using @ref twi_set, followed by a stop condition.
+ * 
+ * After the write operation, the function either performs write acknowledge polling (@ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING) or waits for a fixed write cycle time (@ref AT24CM0X_WRITE_CYCLE_MS), depending on the compile-time configuration. If the device does not acknowledge within @ref AT24CM0X_WRITE_TIMEOUT_MS, it returns @ref AT24CM0X_Status_Timeout. If any TWI error is detected, it returns @ref AT24CM0X_Status_TWI_Error.
+ * 
+ * When integrity checking is enabled (@ref AT24CM0X_ENABLE_INTEGRITY_CHECK), the function reads back the written data and compares every received byte with the original data without an intermediate buffer; the read is terminated at the first mismatch. With @ref AT24CM0X_INTEGRITY_CRC a CRC16 over the data read back is compared instead. If any mismatch is found, it returns @ref AT24CM0X_Status_Data_Error. On success, the function returns @ref AT24CM0X_Status_Done.
+ * 
+ * @param page Page index to write, in the range [0, @ref AT24CM0X_PAGES - 1].
+ * @param data Pointer to the buffer containing the data to be written.
+ * @param size Number of bytes to write; must be greater than 0 and not larger than @ref AT24CM0X_PAGE_SIZE.
+ * 
+ * With @ref AT24CM0X_ENABLE_WRITE_CACHE the data is merged into the write-back cache; only a full page of a page that is not cached is written directly.
+ * 
+ * With @ref AT24CM0X_ENABLE_WRITE_QUEUE data of up to @ref AT24CM0X_WRITE_QUEUE_SPAN_SIZE bytes is queued; larger blocks are written directly after overlapping spans have been drained.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_write_page(unsigned int page, unsigned char *data, unsigned int size)
+{
+	return at24cm0x_device_write_page(at24cm0x_active, page, data, size);
+}
+
+/**
+ * @brief Writes a sequence of bytes to a single page of the given AT24CM0X device.
+ * 
+ * @details
+ * Handle based version of @ref at24cm0x_write_page. The page is checked against the size of the handle.
+ * 
+ * @param device Pointer to a handle initialized with @ref at24cm0x_device_init.
+ * @param page   Page index to write.
+ * @param data   Pointer to the buffer containing the data to be written.
+ * @param size   Number of bytes to write; must be greater than 0 and not larger than @ref AT24CM0X_PAGE_SIZE.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_device_write_page(AT24CM0X_Device *device, unsigned int page, unsigned char *data, unsigned int size)
+{
+	return at24cm0x_device_write_page_offset(device, page, 0, data, size);
+}
+
+/**
+ * @brief Writes a sequence of bytes into a single EEPROM page, starting at an offset within the page.
+ * 
+ * @details
+ * This function writes @p size bytes to the bytes [@p offset, @p offset + @p size - 1] of the given page with a single page write. The remaining bytes of the page are not touched, so a partial page update does not need a read-modify-write of the page. Validation, write-protect handling, write cycle timing, integrity checking, caching and queuing are the same as for @ref at24cm0x_write_page.
+ * 
+ * @param page   Page index to write, in the range [0, @ref AT24CM0X_PAGES - 1].
+ * @param offset Offset of the first byte within the page, in the range [0, @ref AT24CM0X_PAGE_SIZE - 1].
+ * @param data   Pointer to the buffer containing the data to be written.
+ * @param size   Number of bytes to write; must be greater than 0 and not exceed the end of the page.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Page_Error if the page is out of range, @ref AT24CM0X_Status_Address_Error if the offset is outside the page, @ref AT24CM0X_Status_Size_Error if the data does not fit into the page, otherwise the status of the write.
+ */
+AT24CM0X_Status at24cm0x_write_page_offset(unsigned int page, unsigned int offset, const unsigned char *data, unsigned int size)
+{
+	return at24cm0x_device_write_page_offset(at24cm0x_active, page, offset, data, size);
+}
+
+/**
+ * @brief Writes a sequence of bytes into a single page of the given AT24CM0X device, starting at an offset within the page.
+ * 
+ * @details
+ * Handle based version of @ref at24cm0x_write_page_offset. The page is checked against the size of the handle.
+ * 
+ * @param device Pointer to a handle initialized with @ref at24cm0x_device_init.
+ * @param page   Page index to write.
+ * @param offset Offset of the first byte within the page.
+ * @param data   Pointer to the buffer containing the data to be written.
+ * @param size   Number of bytes to write; must be greater than 0 and not exceed the end of the page.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_device_write_page_offset(AT24CM0X_Device *device, unsigned int page, unsigned int offset, const unsigned char *data, unsigned int size)
+{
+	if(page >= (device->size >> AT24CM0X_PAGE_SHIFT))
+	{
+		return AT24CM0X_Status_Page_Error;
+	}
+	
+	if(offset >= AT24CM0X_PAGE_SIZE)
+	{
+		return AT24CM0X_Status_Address_Error;
+	}
+	
+	if(size == 0 || size > (AT24CM0X_PAGE_SIZE - offset))
+	{
+		return AT24CM0X_Status_Size_Error;
+	}
+	
+	return at24cm0x_write_chunk(device, (((unsigned long)page << AT24CM0X_PAGE_SHIFT) + offset), data, size);
+}
+
+/**
+ * @brief Writes a block of bytes to an arbitrary EEPROM address.
+ * 
+ * @details
+ * This function writes @p size bytes starting at @p address to the AT24CM0X EEPROM, independent of page boundaries. It first checks that the start address is within @ref AT24CM0X_MEMORY_SIZE; if not, it returns @ref AT24CM0X_Status_Address_Error. If the size is zero or the block would exceed the end of the memory, it returns @ref AT24CM0X_Status_Size_Error.
+ * 
+ * The buffer is split into a head chunk up to the next page boundary, any number of full chunks of @ref AT24CM0X_PAGE_SIZE bytes, and a tail chunk. Each chunk is transferred as one page write, so every internal write cycle programs as many bytes as possible. Write-protect handling, write cycle timing, integrity checking and write-back caching are the same as for @ref at24cm0x_write_page and are applied to every chunk. The function stops at the first chunk that fails and returns its status.
+ * 
+ * @param address Start EEPROM memory address at which the data will be written.
+ * @param data    Pointer to the buffer containing the data to be written.
+ * @param size    Number of bytes to write; must be greater than 0.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_write(unsigned long address, const unsigned char *data, unsigned long size)
+{
+	return at24cm0x_device_write(at24cm0x_active, address, data, size);
+}
+
+/**
+ * @brief Writes a block of bytes to an arbitrary address of the given AT24CM0X device.
+ * 
+ * @details
+ * Handle based version of @ref at24cm0x_write. The range is checked against the size of the handle.
+ * 
+ * @param device  Pointer to a handle initialized with @ref at24cm0x_device_init.
+ * @param address Start EEPROM memory address at which the data will be written.
+ * @param data    Pointer to the buffer containing the data to be written.
+ * @param size    Number of bytes to write; must be greater than 0.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_device_write(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, unsigned long size)
+{
+	AT24CM0X_Status status = at24cm0x_check_range(device, address, size);
+	
+	while(status == AT24CM0X_Status_Done && size > 0)
+	{
+		unsigned int chunk = at24cm0x_chunk(address, size);
+		
+		status = at24cm0x_write_chunk(device, address, data, chunk);
+		
+		address += chunk;
+		data += chunk;
+		size -= chunk;
+	}
+	return status;
+}
+
+#if defined(AT24CM0X_ENABLE_CONDITIONAL_WRITE) || defined(AT24CM0X_ENABLE_INTEGRITY_CHECK)
+	static TWI_Error at24cm0x_fill_check(AT24CM0X_Device *device, unsigned long address, unsigned char value, unsigned int size, unsigned int *first, unsigned int *last)
+	{
+		TWI_Error error = at24cm0x_read_select(device, address);
+		
+		*first = size;
+		*last = 0;
+		
+		for (unsigned int i=0; i < size && error == TWI_None; i++)
+		{
+			unsigned char data = 0;
+			TWI_Operation ack = TWI_Ack;
+			
+			if(i >= (size - 1))
+			{
+				ack = TWI_NACK;
+			}
+			error |= twi_get(&data, ack);
+			
+			if(data != value)
+			{
+				if(*first == size)
+				{
+					*first = i;
+				}
+				*last = i + 1;
+			}
+		}
+		at24cm0x_bus_stop();
+		
+		#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+			at24cm0x_pointer_read(device, address, size, (error == TWI_None));
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_counters.read_bytes += size;
+			at24cm0x_instrument_error(error);
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+			at24cm0x_speed_update(error);
+		#endif
+		
+		return error;
+	}
+#endif
+
+static TWI_Error at24cm0x_fill_transfer(AT24CM0X_Device *device, unsigned long address, unsigned char value, unsigned int size)
+{
+	TWI_Error error = TWI_None;
+	
+	at24cm0x_bus_start(TWI_Write);
+	error |= at24cm0x_send_address(device, address);
+	
+	if(error == TWI_None)
+	{
+		for (unsigned int i=0; i < size && error == TWI_None; i++)
+		{
+			error |= twi_set(value);
+		}
+	}
+	at24cm0x_bus_stop();
+	
+	#ifdef AT24CM0X_ENABLE_READ_CACHE
+		at24cm0x_read_cache_update(device, address, 0, size);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_READ_AHEAD
+		at24cm0x_read_ahead_update(device, address, size);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+		at24cm0x_pointer_write(device, address, size, (error == TWI_None));
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+		at24cm0x_counters.written_bytes += size;
+		at24cm0x_counters.write_cycles++;
+		at24cm0x_instrument_error(error);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+		at24cm0x_speed_update(error);
+	#endif
+	
+	return error;
+}
+
+static AT24CM0X_Status at24cm0x_fill_block(AT24CM0X_Device *device, unsigned long address, unsigned char value, unsigned int size)
+{
+	TWI_Error error = TWI_None;
+	
+	#if defined(AT24CM0X_ENABLE_CONDITIONAL_WRITE) || defined(AT24CM0X_ENABLE_INTEGRITY_CHECK)
+		unsigned int first = 0;
+		unsigned int last = 0;
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_CONDITIONAL_WRITE
+		if(at24cm0x_fill_check(device, address, value, size, &first, &last) != TWI_None)
+		{
+			return AT24CM0X_Status_TWI_Error;
+		}
+		if(first == size)
+		{
+			at24cm0x_skipped_bytes += size;
+			at24cm0x_skipped_cycles++;
+			
+			return AT24CM0X_Status_Done;
+		}
+		at24cm0x_skipped_bytes += size - (last - first);
+		
+		address += first;
+		size = last - first;
+	#endif
+	
+	#ifdef AT24CM0X_WP_CONTROL_EN
+		at24cm0x_wp(AT24CM0X_WP_Mode_Disabled);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_RETRY
+		AT24CM0X_Status status = AT24CM0X_Status_Done;
+		
+		for (unsigned char retry=0; ; retry++)
+		{
+			error = at24cm0x_fill_transfer(device, address, value, size);
+			
+			if(error != TWI_None && retry < AT24CM0X_RETRIES)
+			{
+				at24cm0x_recover(device);
+			}
+			status = at24cm0x_write_cycle(device);
+			
+			if(error == TWI_None || status != AT24CM0X_Status_Done || retry >= AT24CM0X_RETRIES)
+			{
+				break;
+			}
+		}
+	#else
+		error |= at24cm0x_fill_transfer(device, address, value, size);
+		
+		AT24CM0X_Status status = at24cm0x_write_cycle(device);
+	#endif
+	
+	#ifdef AT24CM0X_WP_CONTROL_EN
+		at24cm0x_wp(AT24CM0X_WP_Mode_Enabled);
+	#endif
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		return status;
+	}
+	
+	#ifdef AT24CM0X_ENABLE_INTEGRITY_CHECK
+		if(at24cm0x_fill_check(device, address, value, size, &first, &last) != TWI_None)
+		{
+			return AT24CM0X_Status_TWI_Error;
+		}
+		if(first != size)
+		{
+			#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+				at24cm0x_counters.integrity_errors++;
+			#endif
+			
+			return AT24CM0X_Status_Data_Error;
+		}
+	#endif
+	
+	if(error != TWI_None)
+	{
+		return AT24CM0X_Status_TWI_Error;
+	}
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Fills a block of the AT24CM0X EEPROM with a constant value.
+ * 
+ * @details
+ * This function executes @ref at24cm0x_device_fill on the device selected with @ref at24cm0x_device.
+ * 
+ * @param address Start EEPROM memory address of the block.
+ * @param value   Value that is written to every byte of the block.
+ * @param size    Number of bytes to fill; must be greater than 0.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_fill(unsigned long address, unsigned char value, unsigned long size)
+{
+	return at24cm0x_device_fill(at24cm0x_active, address, value, size);
+}
+
+/**
+ * @brief Fills a block of the given AT24CM0X device with a constant value.
+ * 
+ * @details
+ * This function writes @p value to @p size bytes starting at @p address. The block is validated like @ref at24cm0x_write and split at page boundaries, so every page is programmed with a single page write. The value is sent directly in the TWI transmit loop, no fill buffer is needed in RAM.
+ * 
+ * With @ref AT24CM0X_ENABLE_CONDITIONAL_WRITE every page is read first (blank check). Pages that already hold the value are skipped, otherwise only the range between the first and the last differing byte is written. With @ref AT24CM0X_ENABLE_INTEGRITY_CHECK every written range is read back and compared with the value. Write-protect handling and write cycle timing are the same as for @ref at24cm0x_write.
+ * 
+ * Cache lines of @ref AT24CM0X_ENABLE_WRITE_CACHE that overlap the block are written and dropped first, pending spans of @ref AT24CM0X_ENABLE_WRITE_QUEUE that overlap the block are written first.
+ * 
+ * @note The bytes are always sent with @ref twi_set, also with @ref AT24CM0X_TWI_BUFFER_TRANSFER.
+ * 
+ * @param device  Pointer to a handle initialized with @ref at24cm0x_device_init.
+ * @param address Start EEPROM memory address of the block.
+ * @param value   Value that is written to every byte of the block.
+ * @param size    Number of bytes to fill; must be greater than 0.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_device_fill(AT24CM0X_Device *device, unsigned long address, unsigned char value, unsigned long size)
+{
+	AT24CM0X_Status status = at24cm0x_check_range(device, address, size);
+	
+	#ifdef AT24CM0X_ENABLE_WRITE_CACHE
+		if(status == AT24CM0X_Status_Done)
+		{
+			status = at24cm0x_cache_sync(device, address, size, 1);
+		}
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_WRITE_QUEUE
+		if(status == AT24CM0X_Status_Done)
+		{
+			status = at24cm0x_queue_sync(device, address, size);
+		}
+	#endif
+	
+	while(status == AT24CM0X_Status_Done && size > 0)
+	{
+		unsigned int chunk = at24cm0x_chunk(address, size);
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_trace_begin(AT24CM0X_Trace_Write, device, address, chunk, at24cm0x_timestamp());
+		#endif
+		
+		status = at24cm0x_fill_block(device, address, value, chunk);
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_trace_end(AT24CM0X_Trace_Write, device, status, at24cm0x_timestamp());
+		#endif
+		
+		address += chunk;
+		size -= chunk;
+	}
+	return status;
+}
+
+/**
+ * @brief Erases the whole AT24CM0X EEPROM.
+ * 
+ * @details
+ * This function sets all bytes of the device selected with @ref at24cm0x_device to `0xFF` with @ref at24cm0x_device_fill.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_erase_all(void)
+{
+	return at24cm0x_device_erase_all(at24cm0x_active);
+}
+
+/**
+ * @brief Erases the whole memory of the given AT24CM0X device.
+ * 
+ * @details
+ * Handle based version of @ref at24cm0x_erase_all. All bytes of the handle's memory are set to `0xFF`.
+ * 
+ * @param device Pointer to a handle initialized with @ref at24cm0x_device_init.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_device_erase_all(AT24CM0X_Device *device)
+{
+	return at24cm0x_device_fill(device, 0, 0xFF, device->size);
+}
+
+#if defined(AT24CM0X_MULTI_DEVICES) && defined(AT24CM0X_WRITE_ACKNOWLEDGE_POLLING)
+	/**
+	 * @brief Writes to several AT24CM0X devices with overlapping write cycles.
+	 * 
+	 * @details
+	 * This function processes a list of write jobs, each targeting its own device on the bus. Instead of waiting for the write cycle of one device before addressing the next, the scheduler sends one page chunk to every device that is ready and then polls the devices that are still programming. A device is written again as soon as it acknowledges its address, so the internal write cycles of all devices run in parallel and the sustained write throughput scales with the number of devices.
+	 * 
+	 * Every job is checked like @ref at24cm0x_write and split at page boundaries. A device that does not acknowledge within @ref AT24CM0X_WRITE_TIMEOUT_MS after the end of its last transfer fails its job with @ref AT24CM0X_Status_Timeout. The time is measured per job with @ref at24cm0x_timestamp, so the transfers to the other devices are included. The poll interval @ref AT24CM0X_WRITE_POLL_INTERVAL_MS is only waited when no device could accept data in a round. With @ref AT24CM0X_ENABLE_INTEGRITY_CHECK each chunk is read back once its write cycle has finished. A failing job stops, the other jobs continue.
+	 * 
+	 * With @ref AT24CM0X_ENABLE_WRITE_CACHE, cache lines of the devices that overlap a job are flushed and dropped before the job is started. Pending spans of @ref AT24CM0X_ENABLE_WRITE_QUEUE that overlap a job are written first. The device selected with @ref at24cm0x_device is not changed.
+	 * 
+	 * @note Only one job per device may be passed, otherwise the write cycles of the same device would be interrupted. The application has to provide @ref at24cm0x_timestamp.
+	 * 
+	 * @param jobs  Pointer to the array of write jobs; the result of each job is stored in its `status` member.
+	 * @param count Number of jobs in the array.
+	 * 
+	 * @return AT24CM0X_Status @ref AT24CM0X_Status_Done if all jobs succeeded, otherwise the status of the first failing job.
+	 */
+	AT24CM0X_Status at24cm0x_write_parallel(AT24CM0X_Write_Job *jobs, unsigned char count)
+	{
+		unsigned char pending = 0;
+		
+		for (unsigned char i=0; i < count; i++)
+		{
+			AT24CM0X_Device *device = at24cm0x_devices + ((jobs[i].identifier & AT24CM0X_ADDRESS_MASK)>>AT24CM0X_ADDRESS_SHIFT);
+			
+			jobs[i].status = at24cm0x_check_range(device, jobs[i].address, jobs[i].size);
+			jobs[i].chunk = 0;
+			
+			#ifdef AT24CM0X_ENABLE_WRITE_CACHE
+				if(jobs[i].status == AT24CM0X_Status_Done)
+				{
+					jobs[i].status = at24cm0x_cache_sync(device, jobs[i].address, jobs[i].size, 1);
+				}
+			#endif
+			
+			#ifdef AT24CM0X_ENABLE_WRITE_QUEUE
+				if(jobs[i].status == AT24CM0X_Status_Done)
+				{
+					jobs[i].status = at24cm0x_queue_sync(device, jobs[i].address, jobs[i].size);
+				}
+			#endif
+			
+			if(jobs[i].status == AT24CM0X_Status_Done)
+			{
+				pending++;
+			}
+		}
+		
+		#ifdef AT24CM0X_WP_CONTROL_EN
+			at24cm0x_wp(AT24CM0X_WP_Mode_Disabled);
+		#endif
+		
+		while(pending > 0)
+		{
+			unsigned char waiting = 1;
+			
+			for (unsigned char i=0; i < count; i++)
+			{
+				AT24CM0X_Write_Job *job = (jobs + i);
+				AT24CM0X_Device *device = at24cm0x_devices + ((job->identifier & AT24CM0X_ADDRESS_MASK)>>AT24CM0X_ADDRESS_SHIFT);
+				
+				if(job->status != AT24CM0X_Status_Done || (job->size == 0 && job->chunk == 0))
+				{
+					continue;
+				}
+				
+				if(job->chunk > 0)
+				{
+					unsigned long elapsed = at24cm0x_timestamp() - job->timestamp;
+					
+					if(at24cm0x_write_probe(device) == TWI_Ack)
+					{
+						if(elapsed >= AT24CM0X_WRITE_TIMEOUT_MS)
+						{
+							job->status = AT24CM0X_Status_Timeout;
+							pending--;
+						}
+						continue;
+					}
+					
+					#ifdef AT24CM0X_ENABLE_WRITE_CYCLE_STATISTICS
+						at24cm0x_write_cycle_record((unsigned int)elapsed);
+					#endif
+					
+					#ifdef AT24CM0X_ENABLE_INTEGRITY_CHECK
+						job->status = at24cm0x_verify(device, (job->address - job->chunk), (job->data - job->chunk), job->chunk);
+					#endif
+					job->chunk = 0;
+					
+					if(job->status != AT24CM0X_Status_Done || job->size == 0)
+					{
+						pending--;
+						continue;
+					}
+				}
+				job->chunk = at24cm0x_chunk(job->address, job->size);
+				waiting = 0;
+				
+				if(at24cm0x_write_transfer(device, job->address, job->data, job->chunk) != TWI_None)
+				{
+					job->status = AT24CM0X_Status_TWI_Error;
+					job->chunk = 0;
+					pending--;
+					continue;
+				}
+				job->timestamp = at24cm0x_timestamp();
+				job->address += job->chunk;
+				job->data += job->chunk;
+				job->size -= job->chunk;
+			}
+			
+			if(waiting && pending > 0)
+			{
+				at24cm0x_wait_ms(AT24CM0X_WRITE_POLL_INTERVAL_MS);
+				
+				#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+					at24cm0x_counters.wait_ms += AT24CM0X_WRITE_POLL_INTERVAL_MS;
+				#endif
+			}
+		}
+		
+		#ifdef AT24CM0X_WP_CONTROL_EN
+			at24cm0x_wp(AT24CM0X_WP_Mode_Enabled);
+		#endif
+		
+		for (unsigned char i=0; i < count; i++)
+		{
+			if(jobs[i].status != AT24CM0X_Status_Done)
+			{
+				return jobs[i].status;
+			}
+		}
+		return AT24CM0X_Status_Done;
+	}
+#endif
+
+#ifdef AT24CM0X_ENABLE_ASYNC_WRITE
+	enum AT24CM0X_Async_State_t
+	{
+		AT24CM0X_Async_State_Idle = 0,
+		AT24CM0X_Async_State_Transfer,
+		AT24CM0X_Async_State_Transfer_Wait,
+		AT24CM0X_Async_State_Write_Cycle,
+		AT24CM0X_Async_State_Read,
+		AT24CM0X_Async_State_Read_Wait
+	};
+	
+	static struct
+	{
+		enum AT24CM0X_Async_State_t state;
+		AT24CM0X_Device *device;
+		AT24CM0X_Status status;
+		AT24CM0X_Callback callback;
+		unsigned long address;
+		const unsigned char *data;
+		unsigned char *buffer;
+		unsigned long size;
+		unsigned int chunk;
+		unsigned long timestamp;
+	} at24cm0x_async;
+	
+	/**
+	 * @brief Submits a non-blocking write job to the AT24CM0X EEPROM.
+	 * 
+	 * @details
+	 * This function validates the address range in the same way as @ref at24cm0x_write and registers the block as the active asynchronous write job. No bus traffic is generated here; the transfer is executed step by step from @ref at24cm0x_task. If a job is still pending, the function returns @ref AT24CM0X_Status_Busy and the new job is rejected.
+	 * 
+	 * The buffer pointed to by @p data is not copied and must stay valid and unchanged until the job has completed. When the job is finished, the optional @p callback is invoked from @ref at24cm0x_task with the final status. With @ref AT24CM0X_ENABLE_WRITE_CACHE, cache lines overlapping the block are flushed and dropped before the job is accepted. With @ref AT24CM0X_ENABLE_WRITE_QUEUE, pending spans overlapping the block are written first.
+	 * 
+	 * @param address  Start EEPROM memory address at which the data will be written.
+	 * @param data     Pointer to the buffer containing the data to be written.
+	 * @param size     Number of bytes to write; must be greater than 0.
+	 * @param callback Function called on completion, or `NULL` if the status is queried with @ref at24cm0x_async_status.
+	 * 
+	 * @return AT24CM0X_Status @ref AT24CM0X_Status_Done if the job was accepted, otherwise the error code.
+	 */
+	AT24CM0X_Status at24cm0x_write_async(unsigned long address, const unsigned char *data, unsigned long size, AT24CM0X_Callback callback)
+	{
+		if(at24cm0x_async.state != AT24CM0X_Async_State_Idle)
+		{
+			return AT24CM0X_Status_Busy;
+		}
+		
+		AT24CM0X_Status status = at24cm0x_check_range(at24cm0x_active, address, size);
+		
+		#ifdef AT24CM0X_ENABLE_WRITE_CACHE
+			if(status == AT24CM0X_Status_Done)
+			{
+				status = at24cm0x_cache_sync(at24cm0x_active, address, size, 1);
+			}
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_WRITE_QUEUE
+			if(status == AT24CM0X_Status_Done)
+			{
+				status = at24cm0x_queue_sync(at24cm0x_active, address, size);
+			}
+		#endif
+		
+		if(status != AT24CM0X_Status_Done)
+		{
+			return status;
+		}
+		
+		at24cm0x_async.device = at24cm0x_active;
+		at24cm0x_async.status = AT24CM0X_Status_Busy;
+		at24cm0x_async.callback = callback;
+		at24cm0x_async.address = address;
+		at24cm0x_async.data = data;
+		at24cm0x_async.size = size;
+		at24cm0x_async.state = AT24CM0X_Async_State_Transfer;
+		
+		return AT24CM0X_Status_Done;
+	}
+	
+	/**
+	 * @brief Submits a non-blocking sequential read job to the AT24CM0X EEPROM.
+	 * 
+	 * @details
+	 * This function validates the parameters in the same way as @ref at24cm0x_read_sequential and registers the read as the active asynchronous job. The transfer is started from @ref at24cm0x_task. With @ref AT24CM0X_TWI_BUFFER_TRANSFER the data phase runs in the background through @ref twi_buffer_get and @ref at24cm0x_task only checks for its completion; without it, the whole read is performed within one @ref at24cm0x_task call. If a job is still pending, the function returns @ref AT24CM0X_Status_Busy.
+	 * 
+	 * @param address  Start EEPROM memory address from which the data will be read.
+	 * @param data     Pointer to the buffer where the received data will be stored; must stay valid until the job has completed.
+	 * @param size     Number of bytes to read; must be greater than 0.
+	 * @param callback Function called on completion, or `NULL` if the status is queried with @ref at24cm0x_async_status.
+	 * 
+	 * @return AT24CM0X_Status @ref AT24CM0X_Status_Done if the job was accepted, otherwise the error code.
+	 */
+	AT24CM0X_Status at24cm0x_read_async(unsigned long address, unsigned char *data, unsigned int size, AT24CM0X_Callback callback)
+	{
+		if(at24cm0x_async.state != AT24CM0X_Async_State_Idle)
+		{
+			return AT24CM0X_Status_Busy;
+		}
+		
+		if(address >= at24cm0x_active->size)
+		{
+			return AT24CM0X_Status_Address_Error;
+		}
+		
+		if(size == 0)
+		{
+			return AT24CM0X_Status_Size_Error;
+		}
+		
+		#ifdef AT24CM0X_ENABLE_WRITE_CACHE
+			AT24CM0X_Status status = at24cm0x_cache_sync(at24cm0x_active, address, size, 0);
+			
+			if(status != AT24CM0X_Status_Done)
+			{
+				return status;
+			}
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_WRITE_QUEUE
+			AT24CM0X_Status status = at24cm0x_queue_sync(at24cm0x_active, address, size);
+			
+			if(status != AT24CM0X_Status_Done)
+			{
+				return status;
+			}
+		#endif
+		
+		at24cm0x_async.device = at24cm0x_active;
+		at24cm0x_async.status = AT24CM0X_Status_Busy;
+		at24cm0x_async.callback = callback;
+		at24cm0x_async.address = address;
+		at24cm0x_async.buffer = data;
+		at24cm0x_async.size = size;
+		at24cm0x_async.state = AT24CM0X_Async_State_Read;
+		
+		return AT24CM0X_Status_Done;
+	}
+	
+	static void at24cm0x_async_finish(AT24CM0X_Status status)
+	{
+		at24cm0x_async.status = status;
+		at24cm0x_async.state = AT24CM0X_Async_State_Idle;
+		
+		if(at24cm0x_async.callback)
+		{
+			at24cm0x_async.callback(status);
+		}
+	}
+	
+	/**
+	 * @brief Advances the asynchronous job of the AT24CM0X driver.
+	 * 
+	 * @details
+	 * This function has to be called periodically (e.g. from the main loop) while a job submitted with @ref at24cm0x_write_async or @ref at24cm0x_read_async is pending. Each call performs at most one step and never busy-waits:
+	 * 
+	 * - In the transfer step the next chunk (up to the next page boundary) is sent with the usual start/address/data/stop sequence. With @ref AT24CM0X_TWI_BUFFER_TRANSFER the data phase is handed to @ref twi_buffer_set and the following calls only check for its completion.
+	 * - In the write cycle step the function checks whether the internal write cycle has completed. With @ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING a single acknowledge poll is issued and the job fails with @ref AT24CM0X_Status_Timeout after @ref AT24CM0X_WRITE_TIMEOUT_MS, otherwise the elapsed time since the end of the transfer is compared against @ref AT24CM0X_WRITE_CYCLE_MS using @ref at24cm0x_timestamp.
+	 * 
+	 * Write-protect control and integrity checking are applied per chunk as in @ref at24cm0x_write. After the last chunk, or after the first failing chunk, the job is completed and the callback is invoked.
+	 * 
+	 * @note While a job is pending, no other driver function must access the bus.
+	 */
+	void at24cm0x_task(void)
+	{
+		switch (at24cm0x_async.state)
+		{
+			case AT24CM0X_Async_State_Transfer:
+			{
+				at24cm0x_async.chunk = at24cm0x_chunk(at24cm0x_async.address, at24cm0x_async.size);
+				
+				#ifdef AT24CM0X_WP_CONTROL_EN
+					at24cm0x_wp(AT24CM0X_WP_Mode_Disabled);
+				#endif
+				
+				#ifdef AT24CM0X_TWI_BUFFER_TRANSFER
+					at24cm0x_bus_start(TWI_Write);
+					
+					if(at24cm0x_send_address(at24cm0x_async.device, at24cm0x_async.address) != TWI_None || twi_buffer_set(at24cm0x_async.data, at24cm0x_async.chunk) != TWI_None)
+					{
+						at24cm0x_async.status = AT24CM0X_Status_TWI_Error;
+					}
+					at24cm0x_async.state = AT24CM0X_Async_State_Transfer_Wait;
+					break;
+				#else
+					if(at24cm0x_write_transfer(at24cm0x_async.device, at24cm0x_async.address, at24cm0x_async.data, at24cm0x_async.chunk) != TWI_None)
+					{
+						at24cm0x_async.status = AT24CM0X_Status_TWI_Error;
+					}
+					at24cm0x_async.timestamp = at24cm0x_timestamp();
+					at24cm0x_async.state = AT24CM0X_Async_State_Write_Cycle;
+				#endif
+			}
+			break;
+			#ifdef AT24CM0X_TWI_BUFFER_TRANSFER
+				case AT24CM0X_Async_State_Transfer_Wait:
+				{
+					if(twi_buffer_busy())
+					{
+						break;
+					}
+					at24cm0x_bus_stop();
+					
+					if(at24cm0x_async.status == AT24CM0X_Status_Busy && twi_buffer_status() != TWI_None)
+					{
+						at24cm0x_async.status = AT24CM0X_Status_TWI_Error;
+					}
+					
+					#ifdef AT24CM0X_ENABLE_READ_CACHE
+						at24cm0x_read_cache_update(at24cm0x_async.device, at24cm0x_async.address, (at24cm0x_async.status == AT24CM0X_Status_Busy ? at24cm0x_async.data : 0), at24cm0x_async.chunk);
+					#endif
+					
+					#ifdef AT24CM0X_ENABLE_READ_AHEAD
+						at24cm0x_read_ahead_update(at24cm0x_async.device, at24cm0x_async.address, at24cm0x_async.chunk);
+					#endif
+					
+					#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+						at24cm0x_pointer_write(at24cm0x_async.device, at24cm0x_async.address, at24cm0x_async.chunk, (at24cm0x_async.status == AT24CM0X_Status_Busy));
+					#endif
+					
+					#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+						at24cm0x_counters.written_bytes += at24cm0x_async.chunk;
+						at24cm0x_counters.write_cycles++;
+					#endif
+					at24cm0x_async.timestamp = at24cm0x_timestamp();
+					at24cm0x_async.state = AT24CM0X_Async_State_Write_Cycle;
+				}
+				break;
+			#endif
+			case AT24CM0X_Async_State_Write_Cycle:
+			{
+				#ifdef AT24CM0X_WRITE_ACKNOWLEDGE_POLLING
+					unsigned long elapsed = at24cm0x_timestamp() - at24cm0x_async.timestamp;
+					
+					if(at24cm0x_write_probe(at24cm0x_async.device) == TWI_Ack)
+					{
+						if(elapsed < AT24CM0X_WRITE_TIMEOUT_MS)
+						{
+							break;
+						}
+						
+						if(at24cm0x_async.status == AT24CM0X_Status_Busy)
+						{
+							at24cm0x_async.status = AT24CM0X_Status_Timeout;
+						}
+					}
+					#ifdef AT24CM0X_ENABLE_WRITE_CYCLE_STATISTICS
+						else
+						{
+							at24cm0x_write_cycle_record((unsigned int)elapsed);
+						}
+					#endif
+				#else
+					if((at24cm0x_timestamp() - at24cm0x_async.timestamp) < AT24CM0X_WRITE_CYCLE_MS)
+					{
+						break;
+					}
+				#endif
+				
+				#ifdef AT24CM0X_WP_CONTROL_EN
+					at24cm0x_wp(AT24CM0X_WP_Mode_Enabled);
+				#endif
+				
+				if(at24cm0x_async.status != AT24CM0X_Status_Busy)
+				{
+					at24cm0x_async_finish(at24cm0x_async.status);
+					break;
+				}
+				
+				#ifdef AT24CM0X_ENABLE_INTEGRITY_CHECK
+					AT24CM0X_Status status = at24cm0x_verify(at24cm0x_async.device, at24cm0x_async.address, at24cm0x_async.data, at24cm0x_async.chunk);
+					
+					if(status != AT24CM0X_Status_Done)
+					{
+						at24cm0x_async_finish(status);
+						break;
+					}
+				#endif
+				
+				at24cm0x_async.address += at24cm0x_async.chunk;
+				at24cm0x_async.data += at24cm0x_async.chunk;
+				at24cm0x_async.size -= at24cm0x_async.chunk;
+				
+				if(at24cm0x_async.size == 0)
+				{
+					at24cm0x_async_finish(AT24CM0X_Status_Done);
+					break;
+				}
+				at24cm0x_async.state = AT24CM0X_Async_State_Transfer;
+			}
+			break;
+			case AT24CM0X_Async_State_Read:
+			{
+				#ifdef AT24CM0X_TWI_BUFFER_TRANSFER
+					if(at24cm0x_read_select(at24cm0x_async.device, at24cm0x_async.address) != TWI_None)
+					{
+						at24cm0x_bus_stop();
+						
+						#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+							at24cm0x_pointer_read(at24cm0x_async.device, at24cm0x_async.address, at24cm0x_async.size, 0);
+						#endif
+						
+						at24cm0x_async_finish(AT24CM0X_Status_TWI_Error);
+						break;
+					}
+					
+					if(twi_buffer_get(at24cm0x_async.buffer, (unsigned int)at24cm0x_async.size) != TWI_None)
+					{
+						at24cm0x_async.status = AT24CM0X_Status_TWI_Error;
+					}
+					at24cm0x_async.state = AT24CM0X_Async_State_Read_Wait;
+				#else
+					at24cm0x_async_finish(at24cm0x_read_block(at24cm0x_async.device, at24cm0x_async.address, at24cm0x_async.buffer, (unsigned int)at24cm0x_async.size));
+				#endif
+			}
+			break;
+			#ifdef AT24CM0X_TWI_BUFFER_TRANSFER
+				case AT24CM0X_Async_State_Read_Wait:
+				{
+					if(twi_buffer_busy())
+					{
+						break;
+					}
+					at24cm0x_bus_stop();
+					
+					unsigned char valid = (at24cm0x_async.status == AT24CM0X_Status_Busy && twi_buffer_status() == TWI_None);
+					
+					#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+						at24cm0x_pointer_read(at24cm0x_async.device, at24cm0x_async.address, at24cm0x_async.size, valid);
+					#endif
+					
+					#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+						at24cm0x_counters.read_bytes += at24cm0x_async.size;
+					#endif
+					
+					if(valid)
+					{
+						at24cm0x_async_finish(AT24CM0X_Status_Done);
+						break;
+					}
+					at24cm0x_async_finish(AT24CM0X_Status_TWI_Error);
+				}
+				break;
+			#endif
+			default:
+			break;
+		}
+	}
+	
+	/**
+	 * @brief Returns the status of the asynchronous job.
+	 * 
+	 * @details
+	 * While a job submitted with @ref at24cm0x_write_async or @ref at24cm0x_read_async is pending, this function returns @ref AT24CM0X_Status_Busy, even if a failure has already been recorded for it. Afterwards it returns the final status of the most recent job, which allows polling for completion instead of using a callback.
+	 * 
+	 * @return AT24CM0X_Status Status of the current or last asynchronous job.
+	 */
+	AT24CM0X_Status at24cm0x_async_status(void)
+	{
+		if(at24cm0x_async.state != AT24CM0X_Async_State_Idle)
+		{
+			return AT24CM0X_Status_Busy;
+		}
+		return at24cm0x_async.status;
+	}
+#endif
+
+#ifdef AT24CM0X_POWER_CONTROL_EN
+	/**
+	 * @brief Writes pending data and switches off the EEPROM supply.
+	 * 
+	 * @details
+	 * This function ends a power on period of the device (see @ref AT24CM0X_POWER_CONTROL_EN). Dirty lines of @ref AT24CM0X_ENABLE_WRITE_CACHE and pending spans of @ref AT24CM0X_ENABLE_WRITE_QUEUE are written first, so all updates since the last power down are programmed in one burst. Afterwards the supply is switched off with @ref at24cm0x_power and the tracked address counters are invalidated, because the device loses its internal address counter. The next bus transaction switches the supply on again.
+	 * 
+	 * @note Call this function before the application enters a long sleep phase. The contents of the read cache and the read-ahead window stay valid.
+	 * 
+	 * @return AT24CM0X_Status @ref AT24CM0X_Status_Busy if an asynchronous job is pending, the status of the first failing write (the supply stays on), otherwise @ref AT24CM0X_Status_Done.
+	 */
+	AT24CM0X_Status at24cm0x_power_down(void)
+	{
+		AT24CM0X_Status status = AT24CM0X_Status_Done;
+		
+		#ifdef AT24CM0X_ENABLE_ASYNC_WRITE
+			if(at24cm0x_async.state != AT24CM0X_Async_State_Idle)
+			{
+				return AT24CM0X_Status_Busy;
+			}
+		#endif
+		
+		#if defined(AT24CM0X_ENABLE_WRITE_CACHE)
+			status = at24cm0x_flush();
+		#elif defined(AT24CM0X_ENABLE_WRITE_QUEUE)
+			status = at24cm0x_write_queue_flush();
+		#endif
+		
+		if(status != AT24CM0X_Status_Done)
+		{
+			return status;
+		}
+		
+		if(at24cm0x_powered)
+		{
+			at24cm0x_power(AT24CM0X_Power_Mode_Off);
+			at24cm0x_powered = 0;
+		}
+		
+		for (unsigned char i=0; i < (sizeof(at24cm0x_devices)/sizeof(at24cm0x_devices[0])); i++)
+		{
+			at24cm0x_devices[i].pointer = AT24CM0X_MEMORY_SIZE;
+		}
+		return AT24CM0X_Status_Done;
+	}
+#endif
+
 /**
  * @brief Reads the current byte from the AT24CM0X EEPROM.
  * 
  * @details
- * This function reads the byte currently addressed by the AT24CM0X internal address counter using a TWI/I2C read operation. It sends a start condition, addresses the device in read mode using the internally stored `at24cm0x_device_identifier`, reads one byte into the provided buffer, and then issues a stop condition.
+ * This function reads the byte currently addressed by the AT24CM0X internal address counter using a TWI/I2C read operation. It sends a start condition, addresses the selected device (@ref at24cm0x_device) in read mode, reads one byte into the provided buffer, and then issues a stop condition.
  * 
  * If any TWI communication error occurs during the sequence, the function returns @ref AT24CM0X_Status_TWI_Error. On success, the received byte is stored at the location pointed to by @p data and the function returns
  * @ref AT24CM0X_Status_Done.
@@ -246,19 +2648,51 @@ AT24CM0X_Status at24cm0x_write_page(unsigned int page, unsigned char *data, unsi
  * @return AT24CM0X_Status Status code indicating the result of the operation.
  */
 AT24CM0X_Status at24cm0x_read_current_byte(unsigned char *data)
+{
+	return at24cm0x_device_read_current_byte(at24cm0x_active, data);
+}
+
+/**
+ * @brief Reads the current byte from the given AT24CM0X device.
+ * 
+ * @details
+ * Handle based version of @ref at24cm0x_read_current_byte.
+ * 
+ * @param device Pointer to a handle initialized with @ref at24cm0x_device_init.
+ * @param data   Pointer to a byte where the received data will be stored.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_device_read_current_byte(AT24CM0X_Device *device, unsigned char *data)
 {
 	TWI_Error error = TWI_None;
 	
-	twi_start();
-	error |= twi_address(at24cm0x_device_identifier, TWI_Read);
-	error |= twi_get(data, TWI_NACK);
-	twi_stop();
+	#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+		at24cm0x_trace_begin(AT24CM0X_Trace_Read, device, device->pointer, 1, at24cm0x_timestamp());
+	#endif
+	
+	at24cm0x_bus_start(TWI_Read);
+	error |= twi_address(device->identifier, TWI_Read);
+	error |= twi_get(data, TWI_NACK);
+	at24cm0x_bus_stop();
+	
+	#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+		at24cm0x_pointer_read(device, device->pointer, 1, (error == TWI_None && device->pointer < AT24CM0X_MEMORY_SIZE));
+	#endif
+	
+	AT24CM0X_Status status = (error == TWI_None ? AT24CM0X_Status_Done : AT24CM0X_Status_TWI_Error);
 	
-	if(error != TWI_None)
-	{
-		return AT24CM0X_Status_TWI_Error;
-	}
-	return AT24CM0X_Status_Done;
+	#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+		at24cm0x_counters.read_bytes++;
+		at24cm0x_instrument_error(error);
+		at24cm0x_trace_end(AT24CM0X_Trace_Read, device, status, at24cm0x_timestamp());
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+		at24cm0x_speed_update(error);
+	#endif
+	
+	return status;
 }
 
 /**
@@ -267,7 +2701,11 @@ AT24CM0X_Status at24cm0x_read_current_byte(unsigned char *data)
  * @details
  * This function reads one byte of data from the specified EEPROM address of the AT24CM0X device. It first checks whether the given address is within the valid memory range defined by @ref AT24CM0X_MEMORY_SIZE; if not, it returns @ref AT24CM0X_Status_Address_Error.
  * 
- * The read operation is performed using a random-read sequence: a start condition is sent, the target address is set via @ref at24cm0x_send_address, and a stop condition is issued. Then a repeated start is generated, the device is addressed in read mode using the current @ref at24cm0x_device_identifier, and a single byte is read with @ref twi_get, followed by a stop condition.
+ * With @ref AT24CM0X_ENABLE_ADDRESS_TRACKING and an internal address counter that already points to @p address, the address phase is skipped and the byte is read with a current address read.
+ * 
+ * The read operation is performed using a random-read sequence: a start condition is sent, the target address is set via @ref at24cm0x_send_address, and a stop condition is issued (omitted with @ref AT24CM0X_REPEATED_START). Then a repeated start is generated, the selected device is addressed in read mode, and a single byte is read with @ref twi_get, followed by a stop condition.
+ * 
+ * With @ref AT24CM0X_ENABLE_WRITE_CACHE, a byte held in the cache is returned without any bus transfer. With @ref AT24CM0X_ENABLE_READ_CACHE the byte is served from the read cache; on a miss the whole cache line around the address is fetched.
  * 
  * If any TWI communication error occurs, the function returns
  * @ref AT24CM0X_Status_TWI_Error. On success, the received byte is stored at the location pointed to by @p data and the function returns @ref AT24CM0X_Status_Done.
@@ -279,28 +2717,29 @@ AT24CM0X_Status at24cm0x_read_current_byte(unsigned char *data)
  */
 AT24CM0X_Status at24cm0x_read_byte(unsigned long address, unsigned char *data)
 {
-	if(address >= AT24CM0X_MEMORY_SIZE)
+	return at24cm0x_device_read_byte(at24cm0x_active, address, data);
+}
+
+/**
+ * @brief Reads a single byte from the given AT24CM0X device.
+ * 
+ * @details
+ * Handle based version of @ref at24cm0x_read_byte. The address is checked against the size of the handle.
+ * 
+ * @param device  Pointer to a handle initialized with @ref at24cm0x_device_init.
+ * @param address EEPROM memory address from which the byte will be read.
+ * @param data    Pointer to a byte where the received data will be stored.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_device_read_byte(AT24CM0X_Device *device, unsigned long address, unsigned char *data)
+{
+	if(address >= device->size)
 	{
 		return AT24CM0X_Status_Address_Error;
 	}
 	
-	AT24CM0X_Status status = AT24CM0X_Status_Done;
-	TWI_Error error = TWI_None;
-	
-	twi_start();
-	error |= at24cm0x_send_address(address);
-	twi_stop();
-	
-	twi_start();
-	error |= twi_address(at24cm0x_device_identifier, TWI_Read);
-	error |= twi_get(data, TWI_NACK);
-	twi_stop();
-	
-	if(error != TWI_None || status != AT24CM0X_Status_Done)
-	{
-		return AT24CM0X_Status_TWI_Error;
-	}
-	return AT24CM0X_Status_Done;
+	return at24cm0x_read_chunk(device, address, data, 1);
 }
 
 /**
@@ -309,7 +2748,11 @@ AT24CM0X_Status at24cm0x_read_byte(unsigned long address, unsigned char *data)
  * @details
  * This function reads a contiguous block of data starting at the specified EEPROM address of the AT24CM0X device. It first verifies that the start address is within the valid memory range defined by @ref AT24CM0X_MEMORY_SIZE; if not, it returns @ref AT24CM0X_Status_Address_Error. If the requested size is zero, it returns @ref AT24CM0X_Status_Size_Error.
  * 
- * The read operation is performed using a random-read followed by a sequential read: a start condition is sent, the target address is set via @ref at24cm0x_send_address, and a stop condition is issued. Then a repeated start is generated, the device is addressed in read mode using the current @ref at24cm0x_device_identifier, and @p size bytes are read into the buffer pointed to by @p data. All bytes except the last are read with an ACK; the final byte is read with NACK to terminate the transfer, followed by a stop condition.
+ * With @ref AT24CM0X_ENABLE_ADDRESS_TRACKING and an internal address counter that already points to @p address, the address phase is skipped and the data is read with a current address read.
+ * 
+ * The read operation is performed using a random-read followed by a sequential read: a start condition is sent, the target address is set via @ref at24cm0x_send_address, and a stop condition is issued (omitted with @ref AT24CM0X_REPEATED_START). Then a repeated start is generated, the selected device is addressed in read mode, and @p size bytes are read into the buffer pointed to by @p data. All bytes except the last are read with an ACK; the final byte is read with NACK to terminate the transfer, followed by a stop condition. With @ref AT24CM0X_TWI_BUFFER_TRANSFER the data phase is handed to the buffered HAL transfer (@ref twi_buffer_get) instead of byte-wise @ref twi_get calls.
+ * 
+ * With @ref AT24CM0X_ENABLE_WRITE_CACHE, cached data takes precedence over the device content. If the whole range is held in the cache, no bus transfer is performed at all. With @ref AT24CM0X_ENABLE_READ_CACHE, reads up to @ref AT24CM0X_READ_CACHE_LINE_SIZE bytes are served from the read cache.
  * 
  * If any TWI communication error occurs, the function returns @ref AT24CM0X_Status_TWI_Error. On success, the received data block is stored in the provided buffer and the function returns @ref AT24CM0X_Status_Done.
  * 
@@ -321,7 +2764,25 @@ AT24CM0X_Status at24cm0x_read_byte(unsigned long address, unsigned char *data)
  */
 AT24CM0X_Status at24cm0x_read_sequential(unsigned long address, unsigned char *data, unsigned int size)
 {
-	if(address >= AT24CM0X_MEMORY_SIZE)
+	return at24cm0x_device_read_sequential(at24cm0x_active, address, data, size);
+}
+
+/**
+ * @brief Reads a sequence of bytes from the given AT24CM0X device.
+ * 
+ * @details
+ * Handle based version of @ref at24cm0x_read_sequential. The address is checked against the size of the handle.
+ * 
+ * @param device  Pointer to a handle initialized with @ref at24cm0x_device_init.
+ * @param address Start EEPROM memory address from which the data will be read.
+ * @param data    Pointer to the buffer where the received data will be stored.
+ * @param size    Number of bytes to read; must be greater than 0.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_device_read_sequential(AT24CM0X_Device *device, unsigned long address, unsigned char *data, unsigned int size)
+{
+	if(address >= device->size)
 	{
 		return AT24CM0X_Status_Address_Error;
 	}
@@ -331,31 +2792,513 @@ AT24CM0X_Status at24cm0x_read_sequential(unsigned long address, unsigned char *d
 		return AT24CM0X_Status_Size_Error;
 	}
 	
-	AT24CM0X_Status status = AT24CM0X_Status_Done;
-	TWI_Error error = TWI_None;
+	return at24cm0x_read_chunk(device, address, data, size);
+}
+
+#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+	/**
+	 * @brief Opens a streaming read at the given EEPROM address.
+	 * 
+	 * @details
+	 * This function sets the start address for the following @ref at24cm0x_stream_read calls. No bus transfer is performed. Because the driver tracks the internal address counter of the device (see @ref AT24CM0X_ENABLE_ADDRESS_TRACKING), only the first read of a stream sends the address phase; all following reads continue with a current address read as long as no other access moves the counter in between.
+	 * 
+	 * @param address Start EEPROM memory address of the stream.
+	 * 
+	 * @return AT24CM0X_Status @ref AT24CM0X_Status_Address_Error if the address is out of range, otherwise @ref AT24CM0X_Status_Done.
+	 */
+	AT24CM0X_Status at24cm0x_stream_open(unsigned long address)
+	{
+		if(address >= AT24CM0X_MEMORY_SIZE)
+		{
+			return AT24CM0X_Status_Address_Error;
+		}
+		at24cm0x_stream_address = address;
+		
+		return AT24CM0X_Status_Done;
+	}
 	
-	twi_start();
-	error |= at24cm0x_send_address(address);
-	twi_stop();
+	/**
+	 * @brief Reads the next block of a stream opened with @ref at24cm0x_stream_open.
+	 * 
+	 * @details
+	 * This function reads @p size bytes at the current stream position with @ref at24cm0x_read_sequential and advances the position on success. The position wraps around at the end of the memory like the internal address counter of the device.
+	 * 
+	 * @param data Pointer to the buffer where the received data will be stored.
+	 * @param size Number of bytes to read; must be greater than 0.
+	 * 
+	 * @return AT24CM0X_Status Status code indicating the result of the operation.
+	 */
+	AT24CM0X_Status at24cm0x_stream_read(unsigned char *data, unsigned int size)
+	{
+		AT24CM0X_Status status = at24cm0x_read_sequential(at24cm0x_stream_address, data, size);
+		
+		if(status == AT24CM0X_Status_Done)
+		{
+			at24cm0x_stream_address = (at24cm0x_stream_address + size) & AT24CM0X_MEMORY_MASK;
+		}
+		return status;
+	}
+#endif
+
+#ifdef AT24CM0X_ENABLE_BATCH
+	static unsigned char at24cm0x_batch_before(const AT24CM0X_Transfer *first, const AT24CM0X_Transfer *second)
+	{
+		if(first->direction != second->direction)
+		{
+			return (first->direction == AT24CM0X_Direction_Write);
+		}
+		return (first->address < second->address);
+	}
 	
-	twi_start();
-	error |= twi_address(at24cm0x_device_identifier, TWI_Read);
+	static AT24CM0X_Status at24cm0x_batch_write(AT24CM0X_Device *device, AT24CM0X_Transfer *transfers, unsigned char count)
+	{
+		TWI_Error error = TWI_None;
+		unsigned long address = transfers[0].address;
+		unsigned int size = 0;
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_trace_begin(AT24CM0X_Trace_Write, device, address, (unsigned int)(transfers[count - 1].address + transfers[count - 1].size - address), at24cm0x_timestamp());
+		#endif
+		
+		#ifdef AT24CM0X_WP_CONTROL_EN
+			at24cm0x_wp(AT24CM0X_WP_Mode_Disabled);
+		#endif
+		
+		at24cm0x_bus_start(TWI_Write);
+		error |= at24cm0x_send_address(device, address);
+		
+		for (unsigned char i=0; i < count && error == TWI_None; i++)
+		{
+			error |= at24cm0x_write_data(device, transfers[i].address, transfers[i].data, transfers[i].size);
+			size += transfers[i].size;
+		}
+		at24cm0x_bus_stop();
+		
+		#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+			at24cm0x_pointer_write(device, address, size, (error == TWI_None));
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_counters.write_cycles++;
+			at24cm0x_instrument_error(error);
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+			at24cm0x_speed_update(error);
+		#endif
+		
+		AT24CM0X_Status status = at24cm0x_write_cycle(device);
+		
+		#ifdef AT24CM0X_WP_CONTROL_EN
+			at24cm0x_wp(AT24CM0X_WP_Mode_Enabled);
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_INTEGRITY_CHECK
+			for (unsigned char i=0; i < count && status == AT24CM0X_Status_Done; i++)
+			{
+				status = at24cm0x_verify(device, transfers[i].address, transfers[i].data, transfers[i].size);
+			}
+		#endif
+		
+		if(status == AT24CM0X_Status_Done && error != TWI_None)
+		{
+			status = AT24CM0X_Status_TWI_Error;
+		}
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_trace_end(AT24CM0X_Trace_Write, device, status, at24cm0x_timestamp());
+		#endif
+		
+		return status;
+	}
 	
-	for (unsigned int i=0; i < size; i++)
+	static AT24CM0X_Status at24cm0x_batch_read(AT24CM0X_Device *device, AT24CM0X_Transfer *transfers, unsigned char count)
 	{
-		TWI_Operation ack = TWI_Ack;
+		unsigned long address = transfers[0].address;
+		unsigned long end = transfers[count - 1].address + transfers[count - 1].size;
+		unsigned long position = address;
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_trace_begin(AT24CM0X_Trace_Read, device, address, (unsigned int)(end - address), at24cm0x_timestamp());
+		#endif
 		
-		if(i >= (size - 1))
+		TWI_Error error = at24cm0x_read_select(device, address);
+		
+		for (unsigned char i=0; i < count && error == TWI_None; i++)
 		{
-			ack = TWI_NACK;
+			while(position < transfers[i].address && error == TWI_None)
+			{
+				unsigned char discard;
+				
+				error |= twi_get(&discard, TWI_Ack);
+				position++;
+			}
+			
+			for (unsigned int j=0; j < transfers[i].size && error == TWI_None; j++)
+			{
+				TWI_Operation ack = TWI_Ack;
+				
+				if((position + 1) >= end)
+				{
+					ack = TWI_NACK;
+				}
+				error |= twi_get((transfers[i].data + j), ack);
+				position++;
+			}
+			
+			#ifdef AT24CM0X_ENABLE_WRITE_CACHE
+				at24cm0x_cache_overlay(device, transfers[i].address, transfers[i].data, transfers[i].size);
+			#endif
+			
+			#ifdef AT24CM0X_ENABLE_WRITE_QUEUE
+				at24cm0x_queue_overlay(device, transfers[i].address, transfers[i].data, transfers[i].size);
+			#endif
 		}
-		error |= twi_get((data + i), ack);
+		at24cm0x_bus_stop();
+		
+		#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+			at24cm0x_pointer_read(device, address, (end - address), (error == TWI_None));
+		#endif
+		
+		AT24CM0X_Status status = (error == TWI_None ? AT24CM0X_Status_Done : AT24CM0X_Status_TWI_Error);
+		
+		#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+			at24cm0x_counters.read_bytes += (position - address);
+			at24cm0x_instrument_error(error);
+			at24cm0x_trace_end(AT24CM0X_Trace_Read, device, status, at24cm0x_timestamp());
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+			at24cm0x_speed_update(error);
+		#endif
+		
+		return status;
+	}
+	
+	/**
+	 * @brief Executes a list of scattered reads and writes on the AT24CM0X EEPROM in one pass.
+	 * 
+	 * @details
+	 * This function executes @ref at24cm0x_device_batch on the device selected with @ref at24cm0x_device.
+	 * 
+	 * @param transfers Pointer to the array of transfer descriptors; the array is sorted in place.
+	 * @param count     Number of descriptors in the array.
+	 * 
+	 * @return AT24CM0X_Status @ref AT24CM0X_Status_Done if all transfers succeeded, otherwise the status of the first failing transfer.
+	 */
+	AT24CM0X_Status at24cm0x_batch(AT24CM0X_Transfer *transfers, unsigned char count)
+	{
+		return at24cm0x_device_batch(at24cm0x_active, transfers, count);
 	}
-	twi_stop();
 	
-	if(error != TWI_None || status != AT24CM0X_Status_Done)
+	/**
+	 * @brief Executes a list of scattered reads and writes on the given AT24CM0X device in one pass.
+	 * 
+	 * @details
+	 * This function checks every descriptor like @ref at24cm0x_write or @ref at24cm0x_read_sequential and sorts the array in place by direction and address. All writes are executed before the reads, so a read returns the data written by the same batch. The result of every descriptor is stored in its `status` member; descriptors with an invalid range are skipped.
+	 * 
+	 * Writes that directly follow each other within one page are sent in a single page write and programmed with one write cycle. Write-protect handling, write cycle timing and integrity checking are the same as for @ref at24cm0x_write. With @ref AT24CM0X_ENABLE_WRITE_CACHE, @ref AT24CM0X_ENABLE_WRITE_QUEUE or @ref AT24CM0X_ENABLE_CONDITIONAL_WRITE, every write is passed to @ref at24cm0x_device_write instead, because these options already merge or skip writes per page.
+	 * 
+	 * Reads with gaps of at most @ref AT24CM0X_BATCH_GAP bytes between them are fetched with a single sequential read transaction; the bytes of the gaps are discarded. Data held by the write cache or the write queue takes precedence over the device content.
+	 * 
+	 * @param device    Pointer to a handle initialized with @ref at24cm0x_device_init.
+	 * @param transfers Pointer to the array of transfer descriptors; the array is sorted in place.
+	 * @param count     Number of descriptors in the array.
+	 * 
+	 * @return AT24CM0X_Status @ref AT24CM0X_Status_Done if all transfers succeeded, otherwise the status of the first failing transfer in sorted order.
+	 */
+	AT24CM0X_Status at24cm0x_device_batch(AT24CM0X_Device *device, AT24CM0X_Transfer *transfers, unsigned char count)
 	{
-		return AT24CM0X_Status_TWI_Error;
+		for (unsigned char i=0; i < count; i++)
+		{
+			transfers[i].status = at24cm0x_check_range(device, transfers[i].address, transfers[i].size);
+			
+			AT24CM0X_Transfer transfer = transfers[i];
+			unsigned char j = i;
+			
+			while(j > 0 && at24cm0x_batch_before(&transfer, &transfers[j - 1]))
+			{
+				transfers[j] = transfers[j - 1];
+				j--;
+			}
+			transfers[j] = transfer;
+		}
+		
+		unsigned char i = 0;
+		
+		while(i < count)
+		{
+			if(transfers[i].status != AT24CM0X_Status_Done)
+			{
+				i++;
+				continue;
+			}
+			
+			AT24CM0X_Status status;
+			unsigned char run = 1;
+			unsigned long end = transfers[i].address + transfers[i].size;
+			
+			if(transfers[i].direction == AT24CM0X_Direction_Write)
+			{
+				#if !defined(AT24CM0X_ENABLE_WRITE_CACHE) && !defined(AT24CM0X_ENABLE_WRITE_QUEUE) && !defined(AT24CM0X_ENABLE_CONDITIONAL_WRITE)
+					while((i + run) < count && transfers[i + run].status == AT24CM0X_Status_Done && transfers[i + run].direction == AT24CM0X_Direction_Write && transfers[i + run].address == end && ((transfers[i].address ^ (end + transfers[i + run].size - 1)) & ~AT24CM0X_PAGE_MASK) == 0)
+					{
+						end += transfers[i + run].size;
+						run++;
+					}
+				#endif
+				
+				if(run == 1)
+				{
+					status = at24cm0x_device_write(device, transfers[i].address, transfers[i].data, transfers[i].size);
+				}
+				else
+				{
+					status = at24cm0x_batch_write(device, (transfers + i), run);
+				}
+			}
+			else
+			{
+				while((i + run) < count && transfers[i + run].status == AT24CM0X_Status_Done && transfers[i + run].address >= end && (transfers[i + run].address - end) <= AT24CM0X_BATCH_GAP)
+				{
+					end = transfers[i + run].address + transfers[i + run].size;
+					run++;
+				}
+				status = at24cm0x_batch_read(device, (transfers + i), run);
+			}
+			
+			for (unsigned char j=0; j < run; j++)
+			{
+				transfers[i + j].status = status;
+			}
+			i += run;
+		}
+		
+		for (i=0; i < count; i++)
+		{
+			if(transfers[i].status != AT24CM0X_Status_Done)
+			{
+				return transfers[i].status;
+			}
+		}
+		return AT24CM0X_Status_Done;
 	}
-	return AT24CM0X_Status_Done;
-}
\ No newline at end of file
+#endif
+
+#ifdef AT24CM0X_ENABLE_IMAGE
+	static AT24CM0X_Status at24cm0x_image_finish(AT24CM0X_Device *device, unsigned long address, const unsigned char *data)
+	{
+		AT24CM0X_Status status = at24cm0x_write_cycle(device);
+		
+		#ifdef AT24CM0X_ENABLE_INTEGRITY_CHECK
+			if(status == AT24CM0X_Status_Done)
+			{
+				status = at24cm0x_verify(device, address, data, AT24CM0X_PAGE_SIZE);
+			}
+		#else
+			(void)address;
+			(void)data;
+		#endif
+		
+		return status;
+	}
+	
+	static unsigned char at24cm0x_image_skip(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, AT24CM0X_Image_Mode mode, AT24CM0X_Status *status)
+	{
+		if(mode == AT24CM0X_Image_Mode_Skip_Blank)
+		{
+			for (unsigned int i=0; i < AT24CM0X_PAGE_SIZE; i++)
+			{
+				if(*(data + i) != 0xFF)
+				{
+					return 0;
+				}
+			}
+			return 1;
+		}
+		
+		if(mode == AT24CM0X_Image_Mode_Skip_Equal)
+		{
+			unsigned int first = 0;
+			unsigned int last = 0;
+			
+			if(at24cm0x_compare(device, address, data, AT24CM0X_PAGE_SIZE, &first, &last) != TWI_None)
+			{
+				*status = AT24CM0X_Status_TWI_Error;
+				return 1;
+			}
+			return (first == AT24CM0X_PAGE_SIZE);
+		}
+		return 0;
+	}
+	
+	/**
+	 * @brief Programs the whole AT24CM0X EEPROM with an image.
+	 * 
+	 * @details
+	 * This function executes @ref at24cm0x_device_program_image on the device selected with @ref at24cm0x_device.
+	 * 
+	 * @param producer Callback that fills the buffer with the image data of each page.
+	 * @param mode     Selects which pages are skipped.
+	 * 
+	 * @return AT24CM0X_Status Status code indicating the result of the operation.
+	 */
+	AT24CM0X_Status at24cm0x_program_image(AT24CM0X_Image_Callback producer, AT24CM0X_Image_Mode mode)
+	{
+		return at24cm0x_device_program_image(at24cm0x_active, producer, mode);
+	}
+	
+	/**
+	 * @brief Programs the whole memory of the given AT24CM0X device with an image.
+	 * 
+	 * @details
+	 * This function requests the image from @p producer in blocks of @ref AT24CM0X_PAGE_SIZE bytes in ascending page order and programs every page with a single full page write. The range is validated once and write-protect is disabled once for the whole image instead of per page. After the transfer of a page the producer fills the buffer with the next page while the device is still in its internal write cycle; only then the end of the write cycle is awaited. The transfer is blocking, so a single page buffer is free again once it has returned. Only with @ref AT24CM0X_ENABLE_INTEGRITY_CHECK a second page buffer keeps the written page for its read-back. With @ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING the preparation of the next page is therefore hidden behind the write cycle, with the fixed delay of @ref AT24CM0X_WRITE_CYCLE_MS it adds to each page.
+	 * 
+	 * With @ref AT24CM0X_Image_Mode_Skip_Blank pages of the image that only contain `0xFF` are not written, which is sufficient for devices in delivery state. With @ref AT24CM0X_Image_Mode_Skip_Equal every page is read and compared first and only pages that differ are written. With @ref AT24CM0X_ENABLE_INTEGRITY_CHECK every written page is read back after its write cycle.
+	 * 
+	 * Data of @ref AT24CM0X_ENABLE_WRITE_CACHE and @ref AT24CM0X_ENABLE_WRITE_QUEUE for this device is written and dropped before the image is programmed.
+	 * 
+	 * @param device   Pointer to a handle initialized with @ref at24cm0x_device_init.
+	 * @param producer Callback that fills the buffer with the image data of each page.
+	 * @param mode     Selects which pages are skipped.
+	 * 
+	 * @return AT24CM0X_Status @ref AT24CM0X_Status_Done if the whole image was programmed, otherwise the status of the first failing page or the status returned by the producer.
+	 */
+	AT24CM0X_Status at24cm0x_device_program_image(AT24CM0X_Device *device, AT24CM0X_Image_Callback producer, AT24CM0X_Image_Mode mode)
+	{
+		#ifdef AT24CM0X_ENABLE_INTEGRITY_CHECK
+			unsigned char buffer[2][AT24CM0X_PAGE_SIZE];
+		#else
+			unsigned char buffer[1][AT24CM0X_PAGE_SIZE];
+		#endif
+		unsigned char current = 0;
+		unsigned long pages = (device->size >> AT24CM0X_PAGE_SHIFT);
+		
+		AT24CM0X_Status status = AT24CM0X_Status_Done;
+		
+		#ifdef AT24CM0X_ENABLE_WRITE_CACHE
+			status = at24cm0x_cache_sync(device, 0, device->size, 1);
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_WRITE_QUEUE
+			status = at24cm0x_queue_sync(device, 0, device->size);
+		#endif
+		
+		if(status != AT24CM0X_Status_Done)
+		{
+			return status;
+		}
+		status = producer(0, buffer[0], AT24CM0X_PAGE_SIZE);
+		
+		#ifdef AT24CM0X_WP_CONTROL_EN
+			at24cm0x_wp(AT24CM0X_WP_Mode_Disabled);
+		#endif
+		
+		for (unsigned long page=0; page < pages && status == AT24CM0X_Status_Done; page++)
+		{
+			unsigned long address = (page << AT24CM0X_PAGE_SHIFT);
+			unsigned char *data = buffer[current];
+			unsigned char written = 0;
+			
+			if(!at24cm0x_image_skip(device, address, data, mode, &status))
+			{
+				if(at24cm0x_write_transfer(device, address, data, AT24CM0X_PAGE_SIZE) != TWI_None)
+				{
+					status = AT24CM0X_Status_TWI_Error;
+					break;
+				}
+				written = 1;
+			}
+			
+			if(status == AT24CM0X_Status_Done && (page + 1) < pages)
+			{
+				#ifdef AT24CM0X_ENABLE_INTEGRITY_CHECK
+					current ^= 1;
+				#endif
+				status = producer((address + AT24CM0X_PAGE_SIZE), buffer[current], AT24CM0X_PAGE_SIZE);
+			}
+			
+			if(written)
+			{
+				AT24CM0X_Status cycle = at24cm0x_image_finish(device, address, data);
+				
+				if(status == AT24CM0X_Status_Done)
+				{
+					status = cycle;
+				}
+			}
+		}
+		
+		#ifdef AT24CM0X_WP_CONTROL_EN
+			at24cm0x_wp(AT24CM0X_WP_Mode_Enabled);
+		#endif
+		
+		return status;
+	}
+	
+	/**
+	 * @brief Reads the whole AT24CM0X EEPROM into a consumer callback.
+	 * 
+	 * @details
+	 * This function executes @ref at24cm0x_device_dump on the device selected with @ref at24cm0x_device.
+	 * 
+	 * @param consumer Callback that receives the memory content page by page.
+	 * 
+	 * @return AT24CM0X_Status Status code indicating the result of the operation.
+	 */
+	AT24CM0X_Status at24cm0x_dump(AT24CM0X_Image_Callback consumer)
+	{
+		return at24cm0x_device_dump(at24cm0x_active, consumer);
+	}
+	
+	/**
+	 * @brief Reads the whole memory of the given AT24CM0X device into a consumer callback.
+	 * 
+	 * @details
+	 * This function reads the memory in blocks of @ref AT24CM0X_PAGE_SIZE bytes in ascending order and passes every block to @p consumer. The last block is shorter if the memory size is not a multiple of the page size. Every block is read in its own transaction, which has ended before the consumer is called, so the bus (and with @ref AT24CM0X_ENABLE_OS_HOOKS the bus lock) is free while the consumer runs. With @ref AT24CM0X_ENABLE_ADDRESS_TRACKING the following blocks continue at the internal address counter of the device without an address phase. If the consumer returns a status other than @ref AT24CM0X_Status_Done, the dump is terminated and this status is returned.
+	 * 
+	 * Data of @ref AT24CM0X_ENABLE_WRITE_CACHE and @ref AT24CM0X_ENABLE_WRITE_QUEUE for this device is written before the dump, so the dump matches the content seen by @ref at24cm0x_read_sequential.
+	 * 
+	 * @param device   Pointer to a handle initialized with @ref at24cm0x_device_init.
+	 * @param consumer Callback that receives the memory content page by page.
+	 * 
+	 * @return AT24CM0X_Status @ref AT24CM0X_Status_TWI_Error on a bus error, the status returned by the consumer if it aborted, otherwise @ref AT24CM0X_Status_Done.
+	 */
+	AT24CM0X_Status at24cm0x_device_dump(AT24CM0X_Device *device, AT24CM0X_Image_Callback consumer)
+	{
+		unsigned char buffer[AT24CM0X_PAGE_SIZE];
+		
+		AT24CM0X_Status status = AT24CM0X_Status_Done;
+		
+		#ifdef AT24CM0X_ENABLE_WRITE_CACHE
+			status = at24cm0x_cache_sync(device, 0, device->size, 0);
+		#endif
+		
+		#ifdef AT24CM0X_ENABLE_WRITE_QUEUE
+			status = at24cm0x_queue_sync(device, 0, device->size);
+		#endif
+		
+		if(status != AT24CM0X_Status_Done)
+		{
+			return status;
+		}
+		
+		for (unsigned long address=0; address < device->size && status == AT24CM0X_Status_Done; address += AT24CM0X_PAGE_SIZE)
+		{
+			unsigned int size = AT24CM0X_PAGE_SIZE;
+			
+			if(size > (device->size - address))
+			{
+				size = (unsigned int)(device->size - address);
+			}
+			status = at24cm0x_read_block(device, address, buffer, size);
+			
+			if(status == AT24CM0X_Status_Done)
+			{
+				status = consumer(address, buffer, size);
+			}
+		}
+		
+		return status;
+	}
+#endif
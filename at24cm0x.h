@@ -32,28 +32,46 @@
 		#define AT24CM0X_HAL_PLATFORM avr0
 	#endif
 
-	#ifndef AT24CM0X_MEMORY_SIZE
+	/**
+	 * @def AT24CM0X_VARIANT_AT24CM01
+	 * @brief Value of @ref AT24CM0X_VARIANT for the AT24CM01 (1 Mbit, 512 pages of 256 bytes).
+	 */
+	#define AT24CM0X_VARIANT_AT24CM01 1
+	
+	/**
+	 * @def AT24CM0X_VARIANT_AT24CM02
+	 * @brief Value of @ref AT24CM0X_VARIANT for the AT24CM02 (2 Mbit, 1024 pages of 256 bytes).
+	 */
+	#define AT24CM0X_VARIANT_AT24CM02 2
+	
+	#ifndef AT24CM0X_VARIANT
 		/** 
-		 * @def AT24CM0X_MEMORY_SIZE
-		 * @brief Total AT24CM0X EEPROM memory size in bytes.
+		 * @def AT24CM0X_VARIANT
+		 * @brief Selects the AT24CM0X device variant.
 		 *
-		 *  This macro defines the overall storage capacity of the AT24CM0X device and is used for address calculations and for validating the accessible address range for read and write operations within the driver.
+		 *  This macro selects the geometry of the device. @ref AT24CM0X_MEMORY_SIZE, @ref AT24CM0X_PAGES, @ref AT24CM0X_PAGE_SIZE and the address masks are derived from it, so a single symbol configures a consistent set of constants. Manual overrides of @ref AT24CM0X_MEMORY_SIZE or @ref AT24CM0X_ADDRESS_MASK that do not match the selected variant are rejected at compile time.
 		 *
-		 * @note The default value `262144UL` corresponds to a 2 Mbit (256 KB) EEPROM. Adjust this value to match the actual device variant in use (for example, 131072UL for 1 Mbit).
+		 * @note The default value @ref AT24CM0X_VARIANT_AT24CM02 selects the 2 Mbit device. Define it as @ref AT24CM0X_VARIANT_AT24CM01 for the 1 Mbit device.
 		 */
-		#define AT24CM0X_MEMORY_SIZE 262144UL
+		#define AT24CM0X_VARIANT AT24CM0X_VARIANT_AT24CM02
 	#endif
-
-	#ifndef AT24CM0X_PAGES
+	
+	#ifndef AT24CM0X_MEMORY_SIZE
 		/** 
-		 * @def AT24CM0X_PAGES
-		 * @brief Number of memory pages of the AT24CM0X EEPROM device.
+		 * @def AT24CM0X_MEMORY_SIZE
+		 * @brief Total AT24CM0X EEPROM memory size in bytes.
 		 *
-		 *  This macro defines how many pages the EEPROM memory is divided into. It is used for page-based addressing and validation in page write and page read operations within the driver.
+		 *  This macro defines the overall storage capacity of the AT24CM0X device and is used for address calculations and for validating the accessible address range for read and write operations within the driver.
 		 *
-		 *  @note The default value `1024UL` corresponds to 1024 pages in total. Make sure this value matches the actual page layout of the selected device.
+		 * @note The value is derived from @ref AT24CM0X_VARIANT: `262144UL` for a 2 Mbit (256 KB) and `131072UL` for a 1 Mbit (128 KB) EEPROM.
 		 */
-		#define AT24CM0X_PAGES 1024UL
+		#if AT24CM0X_VARIANT == AT24CM0X_VARIANT_AT24CM01
+			#define AT24CM0X_MEMORY_SIZE 131072UL
+		#elif AT24CM0X_VARIANT == AT24CM0X_VARIANT_AT24CM02
+			#define AT24CM0X_MEMORY_SIZE 262144UL
+		#else
+			#error "AT24CM0X_VARIANT must be AT24CM0X_VARIANT_AT24CM01 or AT24CM0X_VARIANT_AT24CM02!"
+		#endif
 	#endif
 	
 	#ifndef AT24CM0X_PAGE_SIZE
@@ -63,11 +81,71 @@
 		 *
 		 *  This macro defines how many bytes are contained in one memory page of the AT24CM0X device. It is used for page boundary calculations and for validating buffer sizes in page write operations.
 		 *
-		 * @note The default value `256UL` corresponds to 256 bytes per page. Adjust this value if a device with a different page size is used.
+		 * @note The default value `256UL` corresponds to 256 bytes per page of all AT24CM0X variants. The value has to be a power of two.
 		 */
 		#define AT24CM0X_PAGE_SIZE 256UL
 	#endif
 	
+	#ifndef AT24CM0X_PAGES
+		/** 
+		 * @def AT24CM0X_PAGES
+		 * @brief Number of memory pages of the AT24CM0X EEPROM device.
+		 *
+		 *  This macro defines how many pages the EEPROM memory is divided into. It is used for page-based addressing and validation in page write and page read operations within the driver.
+		 *
+		 *  @note The value is derived from @ref AT24CM0X_MEMORY_SIZE and @ref AT24CM0X_PAGE_SIZE (`1024UL` pages for the AT24CM02, `512UL` for the AT24CM01).
+		 */
+		#define AT24CM0X_PAGES (AT24CM0X_MEMORY_SIZE / AT24CM0X_PAGE_SIZE)
+	#endif
+	
+	/**
+	 * @def AT24CM0X_PAGE_SHIFT
+	 * @brief Binary logarithm of @ref AT24CM0X_PAGE_SIZE.
+	 *
+	 *  Page numbers are converted to addresses and back with shifts by this value instead of multiplications and divisions.
+	 */
+	#if AT24CM0X_PAGE_SIZE == 256UL
+		#define AT24CM0X_PAGE_SHIFT 8
+	#elif AT24CM0X_PAGE_SIZE == 128UL
+		#define AT24CM0X_PAGE_SHIFT 7
+	#elif AT24CM0X_PAGE_SIZE == 64UL
+		#define AT24CM0X_PAGE_SHIFT 6
+	#elif AT24CM0X_PAGE_SIZE == 32UL
+		#define AT24CM0X_PAGE_SHIFT 5
+	#elif AT24CM0X_PAGE_SIZE == 16UL
+		#define AT24CM0X_PAGE_SHIFT 4
+	#else
+		#error "AT24CM0X_PAGE_SIZE must be a power of two in the range [16, 256]!"
+	#endif
+	
+	/**
+	 * @def AT24CM0X_PAGE_MASK
+	 * @brief Mask of the offset of an address within its page.
+	 */
+	#define AT24CM0X_PAGE_MASK (AT24CM0X_PAGE_SIZE - 1UL)
+	
+	/**
+	 * @def AT24CM0X_MEMORY_MASK
+	 * @brief Mask of a memory address, used to wrap the address counter at the end of the memory.
+	 */
+	#define AT24CM0X_MEMORY_MASK (AT24CM0X_MEMORY_SIZE - 1UL)
+	
+	#if AT24CM0X_VARIANT == AT24CM0X_VARIANT_AT24CM01
+		#if AT24CM0X_MEMORY_SIZE != 131072UL
+			#error "AT24CM0X_MEMORY_SIZE must be 131072UL for AT24CM0X_VARIANT_AT24CM01!"
+		#endif
+	#elif AT24CM0X_VARIANT == AT24CM0X_VARIANT_AT24CM02
+		#if AT24CM0X_MEMORY_SIZE != 262144UL
+			#error "AT24CM0X_MEMORY_SIZE must be 262144UL for AT24CM0X_VARIANT_AT24CM02!"
+		#endif
+	#else
+		#error "AT24CM0X_VARIANT must be AT24CM0X_VARIANT_AT24CM01 or AT24CM0X_VARIANT_AT24CM02!"
+	#endif
+	
+	#if (AT24CM0X_PAGES * AT24CM0X_PAGE_SIZE) != AT24CM0X_MEMORY_SIZE
+		#error "AT24CM0X_PAGES * AT24CM0X_PAGE_SIZE must be equal to AT24CM0X_MEMORY_SIZE!"
+	#endif
+	
 	#ifndef AT24CM0X_ENABLE_INTEGRITY_CHECK
 		/** 
 		 * @def AT24CM0X_ENABLE_INTEGRITY_CHECK
@@ -84,6 +162,38 @@
         #endif
 	#endif
 	
+	#ifndef AT24CM0X_INTEGRITY_CRC
+		/** 
+		 * @def AT24CM0X_INTEGRITY_CRC
+		 * @brief Verifies written data with a CRC16 instead of a byte-wise compare.
+		 *
+		 *  By default the integrity check (@ref AT24CM0X_ENABLE_INTEGRITY_CHECK) compares every byte read back against the source buffer and stops at the first mismatch. When this macro is defined, the driver instead calculates a CRC16 (@ref at24cm0x_crc16) over the data read back and compares it with the CRC16 of the source buffer. Both modes work without an additional page sized buffer.
+		 *
+		 * @note By default this macro is commented out. The CRC mode always reads the complete block, the compare mode aborts early on the first mismatch.
+		 */
+		//#define AT24CM0X_INTEGRITY_CRC
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_INTEGRITY_CRC
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_CONDITIONAL_WRITE
+		/** 
+		 * @def AT24CM0X_ENABLE_CONDITIONAL_WRITE
+		 * @brief Skips page writes for data that is already stored in the EEPROM.
+		 *
+		 *  When this macro is defined, every blocking page write first reads the target range and compares it with the new data. Bytes that are already stored are not programmed again: a page that is unchanged is skipped completely, otherwise only the range from the first to the last differing byte is written. This saves the write cycle time (@ref AT24CM0X_WRITE_CYCLE_MS) and reduces wear for idempotent saves. The saved bytes and write cycles are available through @ref at24cm0x_conditional_statistics.
+		 *
+		 * @note By default this macro is commented out. Each write costs an additional read of the target range, which is short compared to a write cycle. Asynchronous (@ref at24cm0x_write_async) and parallel (@ref at24cm0x_write_parallel) writes are not compared.
+		 */
+		//#define AT24CM0X_ENABLE_CONDITIONAL_WRITE
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_CONDITIONAL_WRITE
+        #endif
+	#endif
+	
 	#ifndef AT24CM0X_WRITE_ACKNOWLEDGE_POLLING
 		/** 
 		 * @def AT24CM0X_WRITE_ACKNOWLEDGE_POLLING
@@ -100,6 +210,22 @@
         #endif
 	#endif
 	
+	#ifndef AT24CM0X_ENABLE_WRITE_CYCLE_STATISTICS
+		/** 
+		 * @def AT24CM0X_ENABLE_WRITE_CYCLE_STATISTICS
+		 * @brief Records minimum, maximum and average write cycle times.
+		 *
+		 *  When this macro is defined together with @ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING, the driver measures the time until the device acknowledges again after every write and provides the statistics through @ref at24cm0x_write_cycle_statistics. The results help to tune @ref AT24CM0X_WRITE_CYCLE_MS for the fixed-delay path.
+		 *
+		 * @note By default this macro is commented out. Without acknowledge polling no statistics are recorded.
+		 */
+		//#define AT24CM0X_ENABLE_WRITE_CYCLE_STATISTICS
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_WRITE_CYCLE_STATISTICS
+        #endif
+	#endif
+	
 	/** 
 	 * @def AT24CM0X_BASE_ADDRESS
 	 * @brief Base I2C address of the AT24CM0X EEPROM device.
@@ -145,6 +271,32 @@
 		#endif
 	#endif
 	
+	#if defined(AT24CM0X_ADDRESS_HIGH_MASK) && AT24CM0X_ADDRESS_HIGH_MASK != ((AT24CM0X_MEMORY_SIZE >> 16) - 1)
+		#error "AT24CM0X_ADDRESS_HIGH_MASK does not match AT24CM0X_MEMORY_SIZE!"
+	#endif
+	
+	#if defined(AT24CM0X_ADDRESS_MASK) && ((AT24CM0X_ADDRESS_MASK) & ~(0x07 & ~((AT24CM0X_MEMORY_SIZE >> 16) - 1)))
+		#error "AT24CM0X_ADDRESS_MASK selects address pins that are not present on AT24CM0X_VARIANT!"
+	#endif
+	
+	/**
+	 * @def AT24CM0X_ADDRESS_SHIFT
+	 * @brief Position of the lowest address pin bit within @ref AT24CM0X_ADDRESS_MASK.
+	 */
+	#if (AT24CM0X_ADDRESS_MASK & 0x02)
+		#define AT24CM0X_ADDRESS_SHIFT 1
+	#else
+		#define AT24CM0X_ADDRESS_SHIFT 2
+	#endif
+	
+	/**
+	 * @def AT24CM0X_DEVICES
+	 * @brief Number of devices that can be selected with the address pins of @ref AT24CM0X_ADDRESS_MASK.
+	 *
+	 *  @note The value is `4` for the AT24CM01 (A2 and A1) and `2` for the AT24CM02 (A2 only).
+	 */
+	#define AT24CM0X_DEVICES ((AT24CM0X_ADDRESS_MASK >> AT24CM0X_ADDRESS_SHIFT) + 1)
+	
 	#ifndef AT24CM0X_MULTI_DEVICES
 		/** @def AT24CM0X_MULTI_DEVICES
 		 *  @brief Enables support for multiple AT24CM0X devices on the I2C bus.
@@ -228,6 +380,34 @@
 		#endif
 	#endif
 	
+	#ifndef AT24CM0X_POWER_CONTROL_EN
+		/** 
+		 * @def AT24CM0X_POWER_CONTROL_EN
+		 * @brief Enables software control of the EEPROM supply.
+		 *
+		 *  When this macro is defined, the EEPROM is supplied from a switchable source (e.g. a GPIO or a load switch) that is controlled via @ref at24cm0x_power. The driver switches the supply on before the first bus transaction and waits @ref AT24CM0X_POWER_UP_MS; it stays on until @ref at24cm0x_power_down is called. A burst of writes (e.g. a drain of the write queue or a batch) is therefore programmed within one power on period.
+		 *
+		 * @note By default this macro is disabled, in cause of the EEPROM is permanently supplied in hardware.
+		 */
+		//#define AT24CM0X_POWER_CONTROL_EN
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+			#define AT24CM0X_POWER_CONTROL_EN
+		#endif
+	#endif
+	
+	#ifndef AT24CM0X_POWER_UP_MS
+		/**
+		 * @def AT24CM0X_POWER_UP_MS
+		 * @brief Time between switching on the EEPROM supply and the first bus transaction in milliseconds.
+		 *
+		 *  This macro defines how long the driver waits after @ref at24cm0x_power with @ref AT24CM0X_Power_Mode_On when @ref AT24CM0X_POWER_CONTROL_EN is set.
+		 *
+		 * @note The default value `1UL` covers the power up time of the device and the rise time of a typical supply switch.
+		 */
+		#define AT24CM0X_POWER_UP_MS 1UL
+	#endif
+	
 	#ifndef AT24CM0X_WRITE_CYCLE_MS
 		/**
 		 * @def AT24CM0X_WRITE_CYCLE_MS
@@ -240,69 +420,1086 @@
 		#define AT24CM0X_WRITE_CYCLE_MS 10UL
 	#endif
 	
-	#include "../../../utils/macros/stringify.h"
+	#ifndef AT24CM0X_WRITE_POLL_INTERVAL_MS
+		/**
+		 * @def AT24CM0X_WRITE_POLL_INTERVAL_MS
+		 * @brief Interval between two acknowledge polls in milliseconds.
+		 *
+		 *  This macro defines how long the driver waits with @ref systick_timer_wait_ms between two acknowledge polls when @ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING is set. The interval keeps the bus free for other traffic and is the resolution of the write cycle statistics.
+		 *
+		 * @note The default value `1UL` polls once per millisecond. The value must be greater than 0.
+		 */
+		#define AT24CM0X_WRITE_POLL_INTERVAL_MS 1UL
+	#endif
+	
+	#ifndef AT24CM0X_WRITE_TIMEOUT_MS
+		/**
+		 * @def AT24CM0X_WRITE_TIMEOUT_MS
+		 * @brief Maximum time to wait for the end of a write cycle in milliseconds.
+		 *
+		 *  This macro defines how long acknowledge polling (@ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING) waits for the device to acknowledge again. If the time is exceeded, e.g. because the device is missing, the write is aborted with @ref AT24CM0X_Status_Timeout instead of blocking forever.
+		 *
+		 * @note The default value is twice the write cycle time (@ref AT24CM0X_WRITE_CYCLE_MS).
+		 */
+		#define AT24CM0X_WRITE_TIMEOUT_MS (2UL * AT24CM0X_WRITE_CYCLE_MS)
+	#endif
+	
+	#if AT24CM0X_WRITE_POLL_INTERVAL_MS == 0
+		#error "AT24CM0X_WRITE_POLL_INTERVAL_MS must be greater than 0!"
+	#endif
+	
+	#ifndef AT24CM0X_REPEATED_START
+		/** 
+		 * @def AT24CM0X_REPEATED_START
+		 * @brief Uses a repeated start condition for random reads.
+		 *
+		 *  When this macro is defined, random and sequential reads switch from the dummy write (address phase) to the read-mode address with a repeated start instead of a stop followed by a new start. The bus is not released between both phases, which saves bus time and prevents other masters from taking over the bus in the middle of a read.
+		 *
+		 * @note By default this macro is commented out, so a stop/start sequence is used, which works with every HAL. The repeated start is generated with @ref twi_start unless @ref AT24CM0X_TWI_RESTART_EN is set.
+		 */
+		//#define AT24CM0X_REPEATED_START
 
-	#include _STR(../../../hal/AT24CM0X_HAL_PLATFORM/twi/twi.h)
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_REPEATED_START
+        #endif
+	#endif
 	
-	#include "../../../utils/systick/systick.h"
+	#ifndef AT24CM0X_TWI_RESTART_EN
+		/** 
+		 * @def AT24CM0X_TWI_RESTART_EN
+		 * @brief Generates repeated start conditions with the HAL function @ref twi_restart.
+		 *
+		 *  When this macro is defined together with @ref AT24CM0X_REPEATED_START, the driver calls @ref twi_restart to generate the repeated start. This is required for platforms whose @ref twi_start cannot be issued while the bus is still owned.
+		 *
+		 * @note By default this macro is commented out, so @ref twi_start is used for the repeated start. The function @ref twi_restart has to be provided by the TWI HAL if this macro is defined.
+		 */
+		//#define AT24CM0X_TWI_RESTART_EN
 
-	#ifdef AT24CM0X_WP_CONTROL_EN
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_TWI_RESTART_EN
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_RETRY
+		/** 
+		 * @def AT24CM0X_ENABLE_RETRY
+		 * @brief Retries blocking transfers that failed with a TWI error.
+		 *
+		 *  When this macro is defined, a failed page write, fill or read is not reported immediately. The bus is released with a recovery sequence and the transfer is retried up to @ref AT24CM0X_RETRIES times. A read continues at the first byte that was not received, a page write or fill is sent again after the write cycle of the failed attempt. Independent of this macro every byte loop stops at the first TWI error.
+		 *
+		 * @note By default this macro is commented out, so a TWI error is returned to the caller. Uncomment or define it as a global compiler symbol to enable the retries.
+		 */
+		//#define AT24CM0X_ENABLE_RETRY
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_RETRY
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_RETRIES
 		/**
-		 * @enum AT24CM0X_WP_Mode_t
-		 * @brief Specifies the write-protect mode for the AT24CM0X device.
+		 * @def AT24CM0X_RETRIES
+		 * @brief Maximum number of retries of a failed transfer.
 		 *
-		 * @details
-		 * This enumeration defines the possible states of the EEPROM write-protect (WP) control as used by the AT24CM0X driver.
+		 *  This macro is used when @ref AT24CM0X_ENABLE_RETRY is defined. The transfer fails with @ref AT24CM0X_Status_TWI_Error after the last retry.
+		 *
+		 * @note The default value `3` keeps the worst case duration of a transfer bounded.
 		 */
-		enum AT24CM0X_WP_Mode_t
-		{
-			AT24CM0X_WP_Mode_Enabled = 0,  /**< Write-protect enabled, write access is blocked. */
-			AT24CM0X_WP_Mode_Disabled      /**< Write-protect disabled, write access is allowed. */
-		};
+		#define AT24CM0X_RETRIES 3
+	#endif
+	
+	#ifndef AT24CM0X_TWI_RECOVER_EN
+		/** 
+		 * @def AT24CM0X_TWI_RECOVER_EN
+		 * @brief Releases a stuck bus with the HAL function @ref twi_recover.
+		 *
+		 *  When this macro is defined together with @ref AT24CM0X_ENABLE_RETRY, the driver calls @ref twi_recover before a retry. Otherwise only a stop condition is generated.
+		 *
+		 * @note By default this macro is commented out. The function @ref twi_recover has to be provided by the TWI HAL if this macro is defined.
+		 */
+		//#define AT24CM0X_TWI_RECOVER_EN
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_TWI_RECOVER_EN
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_SPEED_PROFILES
+		/** 
+		 * @def AT24CM0X_ENABLE_SPEED_PROFILES
+		 * @brief Enables per-operation bus speed profiles.
+		 *
+		 *  When this macro is defined, the driver sets the bus clock with the HAL function @ref twi_frequency before every transaction. With @ref AT24CM0X_Speed_Profile_Fast read transactions run at @ref AT24CM0X_SPEED_READ_HZ, other transactions (writes, acknowledge polls) at @ref AT24CM0X_SPEED_WRITE_HZ. With @ref AT24CM0X_Speed_Profile_Safe all transactions run at @ref AT24CM0X_SPEED_SAFE_HZ. After @ref AT24CM0X_SPEED_FALLBACK_ERRORS failing transactions in a row the driver falls back to @ref AT24CM0X_Speed_Profile_Safe on its own; @ref at24cm0x_speed_profile selects a profile.
+		 *
+		 * @note By default this macro is commented out, so the bus clock chosen by @ref twi_init is used for all transactions. The clock is only changed when it differs from the last one set.
+		 */
+		//#define AT24CM0X_ENABLE_SPEED_PROFILES
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_SPEED_PROFILES
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_SPEED_READ_HZ
 		/**
-		 * @typedef AT24CM0X_WP_Mode
-		 * @brief Alias for enum AT24CM0X_WP_Mode_t representing WP control modes.
+		 * @def AT24CM0X_SPEED_READ_HZ
+		 * @brief Bus clock of read transactions of the fast profile in Hz.
+		 *
+		 * @note The default value `1000000UL` is Fast-mode Plus, which is supported by the AT24CM01/02 (see datasheet for the supply range). The pull-up resistors and the bus capacitance of the board have to allow this rate.
 		 */
-		typedef enum AT24CM0X_WP_Mode_t AT24CM0X_WP_Mode;
+		#define AT24CM0X_SPEED_READ_HZ 1000000UL
 	#endif
 	
-	/**
-	 * @enum AT24CM0X_Status_t
-	 * @brief Status codes returned by AT24CM0X driver operations.
-	 *
-	 * @details
-	 * This enumeration defines the possible result codes for EEPROM operations such as initialization, read, and write functions in the AT24CM0X driver.
-	 */
-	enum AT24CM0X_Status_t
-	{
-		AT24CM0X_Status_Done = 0,        /**< Operation completed successfully. */
-		AT24CM0X_Status_Address_Error,   /**< Invalid or out-of-range memory address. */
-		AT24CM0X_Status_Page_Error,      /**< Invalid page number or page boundary issue. */
-		AT24CM0X_Status_Size_Error,      /**< Invalid data length or size parameter. */
-		AT24CM0X_Status_Data_Error,      /**< Data-related error, such as null pointer or corrupt data. */
-		AT24CM0X_Status_TWI_Error,       /**< Error in the underlying TWI/I2C communication. */
-		AT24CM0X_Status_General_Error    /**< Unspecified or unexpected general error. */
-	};
-	/**
-	 * @typedef AT24CM0X_Status
-	 * @brief Alias for enum AT24CM0X_Status_t representing driver status codes.
-	 */
-	typedef enum AT24CM0X_Status_t AT24CM0X_Status;
+	#ifndef AT24CM0X_SPEED_WRITE_HZ
+		/**
+		 * @def AT24CM0X_SPEED_WRITE_HZ
+		 * @brief Bus clock of write transactions and acknowledge polls of the fast profile in Hz.
+		 *
+		 * @note The default value `400000UL` is Fast-mode. Writes are dominated by the internal write cycle, so a higher rate gains little.
+		 */
+		#define AT24CM0X_SPEED_WRITE_HZ 400000UL
+	#endif
 	
-	           void at24cm0x_init(void);
+	#ifndef AT24CM0X_SPEED_SAFE_HZ
+		/**
+		 * @def AT24CM0X_SPEED_SAFE_HZ
+		 * @brief Bus clock of all transactions of the safe profile in Hz.
+		 *
+		 * @note The default value `100000UL` is Standard-mode.
+		 */
+		#define AT24CM0X_SPEED_SAFE_HZ 100000UL
+	#endif
 	
-	#ifdef AT24CM0X_MULTI_DEVICES
-		       void at24cm0x_device(unsigned char identifier);
+	#ifndef AT24CM0X_SPEED_FALLBACK_ERRORS
+		/**
+		 * @def AT24CM0X_SPEED_FALLBACK_ERRORS
+		 * @brief Number of failing transactions in a row after which the fast profile falls back to the safe one.
+		 *
+		 * @note The default value `3` keeps a single disturbed transaction from changing the profile. With @ref AT24CM0X_ENABLE_RETRY a read is counted once with its final result, while every attempt of a page write or fill is counted. The value must be greater than 0.
+		 */
+		#define AT24CM0X_SPEED_FALLBACK_ERRORS 3
 	#endif
 	
-	#ifdef AT24CM0X_WP_CONTROL_EN
-		       void at24cm0x_wp(AT24CM0X_WP_Mode mode);
+	#if AT24CM0X_SPEED_FALLBACK_ERRORS < 1
+		#error "AT24CM0X_SPEED_FALLBACK_ERRORS must be greater than 0!"
 	#endif
 	
-	AT24CM0X_Status at24cm0x_write_byte(unsigned long address, unsigned char data);
-	AT24CM0X_Status at24cm0x_write_page(unsigned int page, unsigned char *data, unsigned int size);
-	AT24CM0X_Status at24cm0x_read_current_byte(unsigned char *data);
-	AT24CM0X_Status at24cm0x_read_byte(unsigned long address, unsigned char *data);
-	AT24CM0X_Status at24cm0x_read_sequential(unsigned long address, unsigned char *data, unsigned int size);
+	#ifndef AT24CM0X_ENABLE_ADDRESS_TRACKING
+		/** 
+		 * @def AT24CM0X_ENABLE_ADDRESS_TRACKING
+		 * @brief Tracks the internal address counter of the AT24CM0X device.
+		 *
+		 *  When this macro is defined, the driver keeps a shadow copy of the internal data word address counter (one per device with @ref AT24CM0X_MULTI_DEVICES). Reads that start at the address the counter already points to skip the three byte address phase and use a current address read instead. The streaming interface @ref at24cm0x_stream_open and @ref at24cm0x_stream_read builds on this for linear reads.
+		 *
+		 * @note By default this macro is commented out, so every random read sends the full address. The shadow copy is only correct if no other master or software accesses the device behind the driver's back.
+		 */
+		//#define AT24CM0X_ENABLE_ADDRESS_TRACKING
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_ADDRESS_TRACKING
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_ASYNC_WRITE
+		/** 
+		 * @def AT24CM0X_ENABLE_ASYNC_WRITE
+		 * @brief Enables the non-blocking, state-machine based write engine.
+		 *
+		 *  When this macro is defined, the driver provides @ref at24cm0x_write_async, @ref at24cm0x_task and @ref at24cm0x_async_status. A write job is executed in small steps from @ref at24cm0x_task, and the internal write cycle is checked with timestamps from @ref at24cm0x_timestamp instead of blocking the CPU.
+		 *
+		 * @note By default this macro is commented out, so only the blocking write functions are available. Uncomment or define it as a global compiler symbol to enable the asynchronous write engine. The application has to provide @ref at24cm0x_timestamp.
+		 */
+		//#define AT24CM0X_ENABLE_ASYNC_WRITE
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_ASYNC_WRITE
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_TWI_BUFFER_TRANSFER
+		/** 
+		 * @def AT24CM0X_TWI_BUFFER_TRANSFER
+		 * @brief Uses buffered (interrupt or DMA driven) TWI transfers for page writes and sequential reads.
+		 *
+		 *  When this macro is defined, the data phase of page writes and sequential reads is handed as a whole buffer to the HAL via @ref twi_buffer_set and @ref twi_buffer_get instead of calling @ref twi_set and @ref twi_get for every byte. Completion is signalled through @ref twi_buffer_busy and @ref twi_buffer_status. Together with @ref AT24CM0X_ENABLE_ASYNC_WRITE the CPU is released during the transfer.
+		 *
+		 * @note By default this macro is commented out, so the polled byte-by-byte transfer is used, which works with every HAL. Only define it if the TWI HAL of the platform implements the buffered transfer functions.
+		 */
+		//#define AT24CM0X_TWI_BUFFER_TRANSFER
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_TWI_BUFFER_TRANSFER
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_WRITE_CACHE
+		/** 
+		 * @def AT24CM0X_ENABLE_WRITE_CACHE
+		 * @brief Enables the write-back RAM page cache.
+		 *
+		 *  When this macro is defined, @ref at24cm0x_write_byte, @ref at24cm0x_write_page and @ref at24cm0x_write merge their data into RAM cache lines of @ref AT24CM0X_PAGE_SIZE bytes instead of writing to the device. Each line tracks the dirty byte range of one page, which is rewritten with a single page write on @ref at24cm0x_flush or when the line is evicted (least recently used). Reads that are fully covered by the cache are served without bus access.
+		 *
+		 * @note By default this macro is commented out, so every write is programmed immediately. Uncomment or define it as a global compiler symbol to enable the cache. Cached data is lost on reset unless @ref at24cm0x_flush has been called.
+		 */
+		//#define AT24CM0X_ENABLE_WRITE_CACHE
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_WRITE_CACHE
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_WRITE_CACHE_LINES
+		/**
+		 * @def AT24CM0X_WRITE_CACHE_LINES
+		 * @brief Number of page lines held by the write-back cache.
+		 *
+		 *  This macro defines how many pages can be cached at the same time when @ref AT24CM0X_ENABLE_WRITE_CACHE is set. Every line occupies @ref AT24CM0X_PAGE_SIZE bytes of RAM plus a few bytes of bookkeeping.
+		 *
+		 * @note The default value `2` keeps the RAM usage low. Increase it if more pages are updated concurrently.
+		 */
+		#define AT24CM0X_WRITE_CACHE_LINES 2
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_WRITE_QUEUE
+		/** 
+		 * @def AT24CM0X_ENABLE_WRITE_QUEUE
+		 * @brief Enables the write coalescing queue.
+		 *
+		 *  When this macro is defined, @ref at24cm0x_write_byte, @ref at24cm0x_write_page and @ref at24cm0x_write store small writes of up to @ref AT24CM0X_WRITE_QUEUE_SPAN_SIZE bytes as pending spans instead of writing to the device. A write that overlaps or adjoins a pending span within the same page is merged into it, so bursts of single byte updates to neighbouring addresses are programmed with one page write per span. The queue is drained when @ref AT24CM0X_WRITE_QUEUE_THRESHOLD spans are pending, when the oldest span is older than @ref AT24CM0X_WRITE_QUEUE_DEADLINE_MS (checked by @ref at24cm0x_write_queue_task and on every queued write) or on @ref at24cm0x_write_queue_flush. Reads return the pending data.
+		 *
+		 * @note By default this macro is commented out, so every write is programmed immediately. Uncomment or define it as a global compiler symbol to enable the queue. The queue uses far less RAM than @ref AT24CM0X_ENABLE_WRITE_CACHE and cannot be combined with it. The application has to provide @ref at24cm0x_timestamp. Pending data is lost on reset unless @ref at24cm0x_write_queue_flush has been called.
+		 */
+		//#define AT24CM0X_ENABLE_WRITE_QUEUE
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_WRITE_QUEUE
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_WRITE_QUEUE_ENTRIES
+		/**
+		 * @def AT24CM0X_WRITE_QUEUE_ENTRIES
+		 * @brief Number of spans held by the write coalescing queue.
+		 *
+		 *  This macro defines how many pending spans can be queued at the same time when @ref AT24CM0X_ENABLE_WRITE_QUEUE is set. Every span occupies @ref AT24CM0X_WRITE_QUEUE_SPAN_SIZE bytes of RAM plus a few bytes of bookkeeping.
+		 *
+		 * @note The default value `4` is sufficient for a few independent writers.
+		 */
+		#define AT24CM0X_WRITE_QUEUE_ENTRIES 4
+	#endif
+	
+	#ifndef AT24CM0X_WRITE_QUEUE_SPAN_SIZE
+		/**
+		 * @def AT24CM0X_WRITE_QUEUE_SPAN_SIZE
+		 * @brief Maximum size of a single span of the write coalescing queue in bytes.
+		 *
+		 *  Writes larger than this size bypass the queue and are programmed immediately, after pending spans that overlap them have been written. A span never crosses a page boundary.
+		 *
+		 * @note The default value `16` merges up to 16 neighbouring single byte writes into one write cycle. The value must not exceed @ref AT24CM0X_PAGE_SIZE.
+		 */
+		#define AT24CM0X_WRITE_QUEUE_SPAN_SIZE 16
+	#endif
+	
+	#ifndef AT24CM0X_WRITE_QUEUE_THRESHOLD
+		/**
+		 * @def AT24CM0X_WRITE_QUEUE_THRESHOLD
+		 * @brief Number of pending spans that triggers draining of the write coalescing queue.
+		 *
+		 * @note The default value is @ref AT24CM0X_WRITE_QUEUE_ENTRIES, so the queue is drained when it is full. The value has to be in the range [1, @ref AT24CM0X_WRITE_QUEUE_ENTRIES].
+		 */
+		#define AT24CM0X_WRITE_QUEUE_THRESHOLD AT24CM0X_WRITE_QUEUE_ENTRIES
+	#endif
+	
+	#ifndef AT24CM0X_WRITE_QUEUE_DEADLINE_MS
+		/**
+		 * @def AT24CM0X_WRITE_QUEUE_DEADLINE_MS
+		 * @brief Maximum time in milliseconds a span stays in the write coalescing queue.
+		 *
+		 *  The age of the oldest pending span is compared against this value with @ref at24cm0x_timestamp. Once it is exceeded, the queue is drained by the next call of @ref at24cm0x_write_queue_task or the next queued write.
+		 *
+		 * @note The default value `50UL` bounds the time unwritten data is held in RAM.
+		 */
+		#define AT24CM0X_WRITE_QUEUE_DEADLINE_MS 50UL
+	#endif
+	
+	#if defined(AT24CM0X_ENABLE_WRITE_QUEUE) && defined(AT24CM0X_ENABLE_WRITE_CACHE)
+		#error "AT24CM0X_ENABLE_WRITE_QUEUE cannot be combined with AT24CM0X_ENABLE_WRITE_CACHE!"
+	#endif
+	
+	#if AT24CM0X_WRITE_QUEUE_SPAN_SIZE < 1 || AT24CM0X_WRITE_QUEUE_SPAN_SIZE > AT24CM0X_PAGE_SIZE
+		#error "AT24CM0X_WRITE_QUEUE_SPAN_SIZE must be in the range [1, AT24CM0X_PAGE_SIZE]!"
+	#endif
+	
+	#if AT24CM0X_WRITE_QUEUE_THRESHOLD < 1 || AT24CM0X_WRITE_QUEUE_THRESHOLD > AT24CM0X_WRITE_QUEUE_ENTRIES
+		#error "AT24CM0X_WRITE_QUEUE_THRESHOLD must be in the range [1, AT24CM0X_WRITE_QUEUE_ENTRIES]!"
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_READ_CACHE
+		/** 
+		 * @def AT24CM0X_ENABLE_READ_CACHE
+		 * @brief Enables the direct-mapped read-through cache.
+		 *
+		 *  When this macro is defined, @ref at24cm0x_read_byte and @ref at24cm0x_read_sequential serve reads of up to @ref AT24CM0X_READ_CACHE_LINE_SIZE bytes from @ref AT24CM0X_READ_CACHE_LINES RAM lines. On a miss the complete line is fetched with one sequential read. Writes issued through the driver update the cached lines, so the cache stays coherent. Hit and miss counters are available through @ref at24cm0x_read_cache_statistics.
+		 *
+		 * @note By default this macro is commented out, so every read accesses the bus. Uncomment or define it as a global compiler symbol to enable the read cache.
+		 */
+		//#define AT24CM0X_ENABLE_READ_CACHE
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_READ_CACHE
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_READ_CACHE_LINES
+		/**
+		 * @def AT24CM0X_READ_CACHE_LINES
+		 * @brief Number of lines of the read cache.
+		 *
+		 *  This macro defines how many lines the direct-mapped read cache holds when @ref AT24CM0X_ENABLE_READ_CACHE is set. A line is selected by `(address / AT24CM0X_READ_CACHE_LINE_SIZE) % AT24CM0X_READ_CACHE_LINES`.
+		 *
+		 * @note The default value `4` together with the default line size uses 64 bytes of RAM for cached data.
+		 */
+		#define AT24CM0X_READ_CACHE_LINES 4
+	#endif
+	
+	#ifndef AT24CM0X_READ_CACHE_LINE_SIZE
+		/**
+		 * @def AT24CM0X_READ_CACHE_LINE_SIZE
+		 * @brief Size of a single read cache line in bytes.
+		 *
+		 *  This macro defines how many bytes are fetched and held per read cache line when @ref AT24CM0X_ENABLE_READ_CACHE is set. Reads larger than one line bypass the cache.
+		 *
+		 * @note The default value `16` fits typical configuration parameters. The value has to be a divisor of @ref AT24CM0X_PAGE_SIZE.
+		 */
+		#define AT24CM0X_READ_CACHE_LINE_SIZE 16
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_READ_AHEAD
+		/** 
+		 * @def AT24CM0X_ENABLE_READ_AHEAD
+		 * @brief Enables the read-ahead window for sequential reads.
+		 *
+		 *  When this macro is defined, @ref at24cm0x_read_byte and @ref at24cm0x_read_sequential detect reads that start where the previous read ended. Such a read fetches a window of @ref AT24CM0X_READ_AHEAD_SIZE bytes with one sequential read, and the following small reads are served from RAM until they leave the window. Writes issued through the driver that overlap the window invalidate it.
+		 *
+		 * @note By default this macro is commented out. It is intended for consumers that read a region linearly in small chunks and cannot be combined with @ref AT24CM0X_ENABLE_READ_CACHE.
+		 */
+		//#define AT24CM0X_ENABLE_READ_AHEAD
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_READ_AHEAD
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_READ_AHEAD_SIZE
+		/**
+		 * @def AT24CM0X_READ_AHEAD_SIZE
+		 * @brief Size of the read-ahead window in bytes.
+		 *
+		 *  Reads that are larger than the window are passed to the device directly.
+		 *
+		 * @note The default value `64` serves eight 8 byte reads with one transaction. Use @ref AT24CM0X_PAGE_SIZE to fetch a complete page.
+		 */
+		#define AT24CM0X_READ_AHEAD_SIZE 64
+	#endif
+	
+	#if defined(AT24CM0X_ENABLE_READ_AHEAD) && defined(AT24CM0X_ENABLE_READ_CACHE)
+		#error "AT24CM0X_ENABLE_READ_AHEAD cannot be combined with AT24CM0X_ENABLE_READ_CACHE!"
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_INSTRUMENTATION
+		/** 
+		 * @def AT24CM0X_ENABLE_INSTRUMENTATION
+		 * @brief Enables the instrumentation counters and trace hooks of the driver.
+		 * 
+		 *  When this macro is defined, the driver counts the bytes read and written on the bus, the issued write cycles, the acknowledge polls, the time blocked in @ref systick_timer_wait_ms, the failed integrity checks and the TWI errors per error bit. The counters are read with @ref at24cm0x_instrumentation. In addition every bus transaction of the blocking functions calls @ref at24cm0x_trace_begin and @ref at24cm0x_trace_end with a timestamp from @ref at24cm0x_timestamp. Both hooks are weak and empty by default and can be overridden by the application.
+		 * 
+		 * @note By default this macro is commented out and the instrumentation is not compiled at all. Uncomment or define it as a global compiler symbol to enable it. The application has to provide @ref at24cm0x_timestamp.
+		 */
+		//#define AT24CM0X_ENABLE_INSTRUMENTATION
+		
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_INSTRUMENTATION
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_OS_HOOKS
+		/** 
+		 * @def AT24CM0X_ENABLE_OS_HOOKS
+		 * @brief Enables the integration hooks for an RTOS.
+		 *
+		 *  When this macro is defined, the driver calls hooks of the application instead of blocking on its own:
+		 *  - `at24cm0x_os_lock()` and `at24cm0x_os_unlock()` enclose every bus transaction (start to stop condition). The bus is released between transactions and during the internal write cycle, so other tasks can use the bus in the meantime.
+		 *  - `at24cm0x_os_sleep(ms)` replaces @ref systick_timer_wait_ms for the write cycle delay and the poll interval, so the calling task sleeps instead of busy waiting.
+		 *  - `at24cm0x_os_yield()` is called while a buffered transfer (@ref AT24CM0X_TWI_BUFFER_TRANSFER) is in progress.
+		 *
+		 * @note By default this macro is commented out. The hooks only serialize the bus. A device does not acknowledge during its own write cycle, so accesses of several tasks to the same device (and to the caches and queues of the driver) still have to be serialized by the application.
+		 */
+		//#define AT24CM0X_ENABLE_OS_HOOKS
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_OS_HOOKS
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_LOW_POWER
+		/** 
+		 * @def AT24CM0X_ENABLE_LOW_POWER
+		 * @brief Enables sleeping of the MCU during the internal write cycle.
+		 *
+		 *  When this macro is defined, the driver calls `at24cm0x_power_sleep(ms)` of the application instead of @ref systick_timer_wait_ms for the write cycle delay and the poll interval. The hook should put the MCU into a sleep mode (e.g. idle or standby) with a timer wakeup after @p ms milliseconds, so no active mode current is spent while the EEPROM programs a page.
+		 *
+		 * @note By default this macro is commented out. The hook may return early (e.g. on another interrupt); the driver handles this like a completed delay. Without @ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING the MCU sleeps once per page for @ref AT24CM0X_WRITE_CYCLE_MS.
+		 */
+		//#define AT24CM0X_ENABLE_LOW_POWER
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_LOW_POWER
+        #endif
+	#endif
+	
+	#if defined(AT24CM0X_ENABLE_LOW_POWER) && defined(AT24CM0X_ENABLE_OS_HOOKS)
+		#error "AT24CM0X_ENABLE_LOW_POWER cannot be combined with AT24CM0X_ENABLE_OS_HOOKS, the RTOS enters the sleep mode through at24cm0x_os_sleep!"
+	#endif
+	
+	#ifndef AT24CM0X_INSTRUMENTATION_ERROR_BITS
+		/**
+		 * @def AT24CM0X_INSTRUMENTATION_ERROR_BITS
+		 * @brief Number of TWI error bits that are counted separately by the instrumentation.
+		 * 
+		 *  Entry `i` of `twi_errors` in @ref AT24CM0X_Instrumentation counts the transactions whose accumulated @ref TWI_Error had bit `i` set.
+		 * 
+		 * @note The default value `8` covers the error flags of the HAL.
+		 */
+		#define AT24CM0X_INSTRUMENTATION_ERROR_BITS 8
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_BATCH
+		/** 
+		 * @def AT24CM0X_ENABLE_BATCH
+		 * @brief Enables the scatter/gather batch functions.
+		 *
+		 *  When this macro is defined, the driver provides @ref at24cm0x_batch and @ref at24cm0x_device_batch. A batch is a list of read and write descriptors that is sorted by address and executed in one pass: contiguous writes within a page are programmed with a single write cycle, and reads that follow each other with gaps of at most @ref AT24CM0X_BATCH_GAP bytes are fetched with a single sequential read transaction.
+		 *
+		 * @note By default this macro is commented out to keep the code size small. Uncomment or define it as a global compiler symbol to enable the batch functions.
+		 */
+		//#define AT24CM0X_ENABLE_BATCH
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_BATCH
+        #endif
+	#endif
+	
+	#ifndef AT24CM0X_BATCH_GAP
+		/**
+		 * @def AT24CM0X_BATCH_GAP
+		 * @brief Maximum number of unused bytes between two reads of a batch that are still merged into one transaction.
+		 *
+		 *  The bytes of the gap are read and discarded, which is cheaper than a new address phase for small gaps.
+		 *
+		 * @note The default value `4` corresponds to the length of the address phase of a random read. Set it to `0` to merge only directly adjacent reads.
+		 */
+		#define AT24CM0X_BATCH_GAP 4
+	#endif
+	
+	#ifndef AT24CM0X_ENABLE_IMAGE
+		/** 
+		 * @def AT24CM0X_ENABLE_IMAGE
+		 * @brief Enables the whole-chip image programming and dump functions.
+		 *
+		 *  When this macro is defined, the driver provides @ref at24cm0x_program_image and @ref at24cm0x_dump (and their handle based versions). The image is streamed page by page from or to a callback of the application. While a page is programming, the callback already prepares the next page, so with @ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING the programming time approaches `AT24CM0X_PAGES` write cycles.
+		 *
+		 * @note By default this macro is commented out. Uncomment or define it as a global compiler symbol to enable the image functions. @ref at24cm0x_program_image places two buffers of @ref AT24CM0X_PAGE_SIZE bytes on the stack.
+		 */
+		//#define AT24CM0X_ENABLE_IMAGE
+
+		#ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define AT24CM0X_ENABLE_IMAGE
+        #endif
+	#endif
+	
+	#include <stdint.h>
+	
+	#include "../../../utils/macros/stringify.h"
+
+	#include _STR(../../../hal/AT24CM0X_HAL_PLATFORM/twi/twi.h)
+	
+	#include "../../../utils/systick/systick.h"
+
+	#ifdef AT24CM0X_TWI_RESTART_EN
+		/**
+		 * @brief Generates a repeated start condition (HAL contract).
+		 *
+		 * @details
+		 * Has to be implemented by the TWI HAL of the platform if @ref AT24CM0X_TWI_RESTART_EN is defined. The function generates a repeated start condition while the bus is owned by the master, without a preceding stop condition.
+		 */
+		void twi_restart(void);
+	#endif
+	
+	#ifdef AT24CM0X_TWI_RECOVER_EN
+		/**
+		 * @brief Releases a stuck bus (HAL contract).
+		 *
+		 * @details
+		 * Has to be implemented by the TWI HAL of the platform if @ref AT24CM0X_TWI_RECOVER_EN is defined. A device that was interrupted while sending a byte can hold SDA low. The function clocks SCL (up to nine times) until SDA is released and then generates a stop condition.
+		 */
+		void twi_recover(void);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+		/**
+		 * @brief Sets the bus clock (HAL contract).
+		 *
+		 * @details
+		 * Has to be implemented by the TWI HAL of the platform if @ref AT24CM0X_ENABLE_SPEED_PROFILES is defined. The function is called while the bus is idle (before the start condition) and sets the SCL frequency to the nearest supported rate that does not exceed @p frequency.
+		 *
+		 * @param frequency Requested SCL frequency in Hz.
+		 */
+		void twi_frequency(unsigned long frequency);
+	#endif
+	
+	#ifdef AT24CM0X_TWI_BUFFER_TRANSFER
+		/**
+		 * @brief Starts a buffered transmission of @p size bytes (HAL contract).
+		 *
+		 * @details
+		 * Has to be implemented by the TWI HAL of the platform. The function starts an interrupt or DMA driven transmission of the buffer after the address phase and returns immediately. The buffer stays valid until @ref twi_buffer_busy returns `0`.
+		 *
+		 * @param data Pointer to the data to transmit.
+		 * @param size Number of bytes to transmit.
+		 *
+		 * @return TWI_Error Error detected while starting the transfer.
+		 */
+		TWI_Error twi_buffer_set(const unsigned char *data, unsigned int size);
+		
+		/**
+		 * @brief Starts a buffered reception of @p size bytes (HAL contract).
+		 *
+		 * @details
+		 * Has to be implemented by the TWI HAL of the platform. The function starts an interrupt or DMA driven reception into the buffer after the device has been addressed in read mode and returns immediately. All bytes except the last are acknowledged, the last byte is answered with a NACK.
+		 *
+		 * @param data Pointer to the receive buffer.
+		 * @param size Number of bytes to receive.
+		 *
+		 * @return TWI_Error Error detected while starting the transfer.
+		 */
+		TWI_Error twi_buffer_get(unsigned char *data, unsigned int size);
+		
+		/**
+		 * @brief Returns whether a buffered transfer is in progress (HAL contract).
+		 *
+		 * @return unsigned char `1` while the transfer is running, `0` when it has completed.
+		 */
+		unsigned char twi_buffer_busy(void);
+		
+		/**
+		 * @brief Returns the result of the last buffered transfer (HAL contract).
+		 *
+		 * @return TWI_Error Accumulated error flags of the completed transfer.
+		 */
+		TWI_Error twi_buffer_status(void);
+	#endif
+	
+	#ifdef AT24CM0X_WP_CONTROL_EN
+		/**
+		 * @enum AT24CM0X_WP_Mode_t
+		 * @brief Specifies the write-protect mode for the AT24CM0X device.
+		 *
+		 * @details
+		 * This enumeration defines the possible states of the EEPROM write-protect (WP) control as used by the AT24CM0X driver.
+		 */
+		enum AT24CM0X_WP_Mode_t
+		{
+			AT24CM0X_WP_Mode_Enabled = 0,  /**< Write-protect enabled, write access is blocked. */
+			AT24CM0X_WP_Mode_Disabled      /**< Write-protect disabled, write access is allowed. */
+		};
+		/**
+		 * @typedef AT24CM0X_WP_Mode
+		 * @brief Alias for enum AT24CM0X_WP_Mode_t representing WP control modes.
+		 */
+		typedef enum AT24CM0X_WP_Mode_t AT24CM0X_WP_Mode;
+	#endif
+	
+	#ifdef AT24CM0X_POWER_CONTROL_EN
+		/**
+		 * @enum AT24CM0X_Power_Mode_t
+		 * @brief Specifies the supply state for the AT24CM0X device.
+		 *
+		 * @details
+		 * This enumeration defines the possible states of the switchable EEPROM supply as used by the AT24CM0X driver.
+		 */
+		enum AT24CM0X_Power_Mode_t
+		{
+			AT24CM0X_Power_Mode_Off = 0,  /**< Supply switched off, the device is not accessible. */
+			AT24CM0X_Power_Mode_On        /**< Supply switched on, the device is accessible. */
+		};
+		/**
+		 * @typedef AT24CM0X_Power_Mode
+		 * @brief Alias for enum AT24CM0X_Power_Mode_t representing supply states.
+		 */
+		typedef enum AT24CM0X_Power_Mode_t AT24CM0X_Power_Mode;
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+		/**
+		 * @enum AT24CM0X_Speed_Profile_t
+		 * @brief Specifies the bus speed profile of the AT24CM0X driver.
+		 *
+		 * @details
+		 * This enumeration defines the bus clocks used for the transactions of the driver (see @ref AT24CM0X_ENABLE_SPEED_PROFILES).
+		 */
+		enum AT24CM0X_Speed_Profile_t
+		{
+			AT24CM0X_Speed_Profile_Fast = 0,  /**< Reads at @ref AT24CM0X_SPEED_READ_HZ, writes at @ref AT24CM0X_SPEED_WRITE_HZ. */
+			AT24CM0X_Speed_Profile_Safe       /**< All transactions at @ref AT24CM0X_SPEED_SAFE_HZ. */
+		};
+		/**
+		 * @typedef AT24CM0X_Speed_Profile
+		 * @brief Alias for enum AT24CM0X_Speed_Profile_t representing bus speed profiles.
+		 */
+		typedef enum AT24CM0X_Speed_Profile_t AT24CM0X_Speed_Profile;
+	#endif
+	
+	/**
+	 * @enum AT24CM0X_Status_t
+	 * @brief Status codes returned by AT24CM0X driver operations.
+	 *
+	 * @details
+	 * This enumeration defines the possible result codes for EEPROM operations such as initialization, read, and write functions in the AT24CM0X driver.
+	 */
+	enum AT24CM0X_Status_t
+	{
+		AT24CM0X_Status_Done = 0,        /**< Operation completed successfully. */
+		AT24CM0X_Status_Address_Error,   /**< Invalid or out-of-range memory address. */
+		AT24CM0X_Status_Page_Error,      /**< Invalid page number or page boundary issue. */
+		AT24CM0X_Status_Size_Error,      /**< Invalid data length or size parameter. */
+		AT24CM0X_Status_Data_Error,      /**< Data-related error, such as null pointer or corrupt data. */
+		AT24CM0X_Status_TWI_Error,       /**< Error in the underlying TWI/I2C communication. */
+		AT24CM0X_Status_General_Error,   /**< Unspecified or unexpected general error. */
+		AT24CM0X_Status_Busy,            /**< A previously started operation is still in progress. */
+		AT24CM0X_Status_Timeout          /**< The device did not respond within the configured timeout. */
+	};
+	/**
+	 * @typedef AT24CM0X_Status
+	 * @brief Alias for enum AT24CM0X_Status_t representing driver status codes.
+	 */
+	typedef enum AT24CM0X_Status_t AT24CM0X_Status;
+	
+	#ifdef AT24CM0X_ENABLE_ASYNC_WRITE
+		/**
+		 * @typedef AT24CM0X_Callback
+		 * @brief Completion callback of an asynchronous AT24CM0X operation.
+		 *
+		 * @param status Final status of the finished operation.
+		 */
+		typedef void (*AT24CM0X_Callback)(AT24CM0X_Status status);
+	#endif
+	
+	/**
+	 * @struct AT24CM0X_Device_t
+	 * @brief Handle of a single AT24CM0X device.
+	 *
+	 * @details
+	 * A handle holds the bus address, the geometry and the state of one device and is passed to the handle based functions (e.g. @ref at24cm0x_device_write). It has to be initialized with @ref at24cm0x_device_init. The global functions (e.g. @ref at24cm0x_write) operate on an internal handle that is selected with @ref at24cm0x_device.
+	 */
+	struct AT24CM0X_Device_t
+	{
+		unsigned char identifier;   /**< 7-bit TWI/I2C address of the device. */
+		unsigned long size;         /**< Usable memory size in bytes, at most @ref AT24CM0X_MEMORY_SIZE. */
+		unsigned long pointer;      /**< Tracked internal address counter (see @ref AT24CM0X_ENABLE_ADDRESS_TRACKING), @ref AT24CM0X_MEMORY_SIZE if unknown. */
+	};
+	/**
+	 * @typedef AT24CM0X_Device
+	 * @brief Alias for struct AT24CM0X_Device_t.
+	 */
+	typedef struct AT24CM0X_Device_t AT24CM0X_Device;
+	
+	#if defined(AT24CM0X_WRITE_ACKNOWLEDGE_POLLING) && defined(AT24CM0X_ENABLE_WRITE_CYCLE_STATISTICS)
+		/**
+		 * @struct AT24CM0X_Write_Cycle_Statistics_t
+		 * @brief Measured write cycle times of the AT24CM0X device.
+		 *
+		 * @details
+		 * All times are given in milliseconds with the resolution of @ref AT24CM0X_WRITE_POLL_INTERVAL_MS.
+		 */
+		struct AT24CM0X_Write_Cycle_Statistics_t
+		{
+			unsigned int minimum;  /**< Shortest observed write cycle. */
+			unsigned int maximum;  /**< Longest observed write cycle. */
+			unsigned int average;  /**< Average of all observed write cycles. */
+			unsigned long count;   /**< Number of observed write cycles. */
+		};
+		/**
+		 * @typedef AT24CM0X_Write_Cycle_Statistics
+		 * @brief Alias for struct AT24CM0X_Write_Cycle_Statistics_t.
+		 */
+		typedef struct AT24CM0X_Write_Cycle_Statistics_t AT24CM0X_Write_Cycle_Statistics;
+	#endif
+	
+	#if defined(AT24CM0X_MULTI_DEVICES) && defined(AT24CM0X_WRITE_ACKNOWLEDGE_POLLING)
+		/**
+		 * @struct AT24CM0X_Write_Job_t
+		 * @brief Write job for one device used by @ref at24cm0x_write_parallel.
+		 *
+		 * @details
+		 * The members `identifier`, `address`, `data` and `size` describe the job and are advanced by the driver while the job is processed. The members `chunk` and `timestamp` are used internally by the scheduler and need not be initialized.
+		 */
+		struct AT24CM0X_Write_Job_t
+		{
+			unsigned char identifier;    /**< Device selector value as used by @ref at24cm0x_device. */
+			unsigned long address;       /**< Start EEPROM memory address of the job. */
+			const unsigned char *data;   /**< Pointer to the data to be written. */
+			unsigned long size;          /**< Number of bytes to write. */
+			AT24CM0X_Status status;      /**< Result of the job. */
+			unsigned int chunk;          /**< Number of bytes of the page currently being programmed. */
+			unsigned long timestamp;     /**< Value of @ref at24cm0x_timestamp at the start of the current write cycle. */
+		};
+		/**
+		 * @typedef AT24CM0X_Write_Job
+		 * @brief Alias for struct AT24CM0X_Write_Job_t.
+		 */
+		typedef struct AT24CM0X_Write_Job_t AT24CM0X_Write_Job;
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+		/**
+		 * @struct AT24CM0X_Instrumentation_t
+		 * @brief Instrumentation counters of the AT24CM0X driver.
+		 * 
+		 * @details
+		 * All counters are cleared by @ref at24cm0x_init.
+		 */
+		struct AT24CM0X_Instrumentation_t
+		{
+			unsigned long read_bytes;                                        /**< Data bytes read from the bus (including read back and compare reads). */
+			unsigned long written_bytes;                                     /**< Data bytes written to the bus. */
+			unsigned long write_cycles;                                      /**< Issued page writes, each starting an internal write cycle. */
+			unsigned long polls;                                             /**< Acknowledge polls. */
+			unsigned long wait_ms;                                           /**< Time in milliseconds blocked in @ref systick_timer_wait_ms. */
+			unsigned long integrity_errors;                                  /**< Failed integrity checks. */
+			unsigned long retries;                                           /**< Retried transfers (see @ref AT24CM0X_ENABLE_RETRY). */
+			unsigned long twi_errors[AT24CM0X_INSTRUMENTATION_ERROR_BITS];   /**< Failed transactions per TWI error bit. */
+		};
+		/**
+		 * @typedef AT24CM0X_Instrumentation
+		 * @brief Alias for struct AT24CM0X_Instrumentation_t.
+		 */
+		typedef struct AT24CM0X_Instrumentation_t AT24CM0X_Instrumentation;
+		
+		/**
+		 * @enum AT24CM0X_Trace_t
+		 * @brief Kind of a traced bus transaction.
+		 */
+		enum AT24CM0X_Trace_t
+		{
+			AT24CM0X_Trace_Read = 0,   /**< Sequential or current address read. */
+			AT24CM0X_Trace_Write       /**< Page write including its write cycle and integrity check. */
+		};
+		/**
+		 * @typedef AT24CM0X_Trace
+		 * @brief Alias for enum AT24CM0X_Trace_t.
+		 */
+		typedef enum AT24CM0X_Trace_t AT24CM0X_Trace;
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_IMAGE
+		/**
+		 * @typedef AT24CM0X_Image_Callback
+		 * @brief Producer or consumer of image data.
+		 *
+		 * @param address Address of the first byte of the block within the device.
+		 * @param data    Pointer to the block that has to be filled (programming) or that holds the data read from the device (dump).
+		 * @param size    Number of bytes of the block.
+		 *
+		 * @return AT24CM0X_Status @ref AT24CM0X_Status_Done to continue, any other status aborts the operation with this status.
+		 */
+		typedef AT24CM0X_Status (*AT24CM0X_Image_Callback)(unsigned long address, unsigned char *data, unsigned int size);
+		
+		/**
+		 * @enum AT24CM0X_Image_Mode_t
+		 * @brief Selects which pages are skipped by @ref at24cm0x_program_image.
+		 */
+		enum AT24CM0X_Image_Mode_t
+		{
+			AT24CM0X_Image_Mode_All = 0,      /**< Every page is programmed. */
+			AT24CM0X_Image_Mode_Skip_Blank,   /**< Pages of the image that only contain `0xFF` are skipped (for devices in delivery state). */
+			AT24CM0X_Image_Mode_Skip_Equal    /**< Pages that already hold the data are skipped; every page is read and compared first. */
+		};
+		/**
+		 * @typedef AT24CM0X_Image_Mode
+		 * @brief Alias for enum AT24CM0X_Image_Mode_t.
+		 */
+		typedef enum AT24CM0X_Image_Mode_t AT24CM0X_Image_Mode;
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_BATCH
+		/**
+		 * @enum AT24CM0X_Direction_t
+		 * @brief Direction of a transfer descriptor of a batch.
+		 */
+		enum AT24CM0X_Direction_t
+		{
+			AT24CM0X_Direction_Read = 0,    /**< Data is read from the device into the buffer. */
+			AT24CM0X_Direction_Write        /**< Data of the buffer is written to the device. */
+		};
+		/**
+		 * @typedef AT24CM0X_Direction
+		 * @brief Alias for enum AT24CM0X_Direction_t.
+		 */
+		typedef enum AT24CM0X_Direction_t AT24CM0X_Direction;
+		
+		/**
+		 * @struct AT24CM0X_Transfer_t
+		 * @brief Transfer descriptor used by @ref at24cm0x_batch.
+		 *
+		 * @details
+		 * The members `address`, `data`, `size` and `direction` describe the transfer. The result of the transfer is stored in `status`.
+		 */
+		struct AT24CM0X_Transfer_t
+		{
+			unsigned long address;          /**< Start EEPROM memory address of the transfer. */
+			unsigned char *data;            /**< Pointer to the buffer of the transfer. */
+			unsigned int size;              /**< Number of bytes to transfer. */
+			AT24CM0X_Direction direction;   /**< Direction of the transfer. */
+			AT24CM0X_Status status;         /**< Result of the transfer. */
+		};
+		/**
+		 * @typedef AT24CM0X_Transfer
+		 * @brief Alias for struct AT24CM0X_Transfer_t.
+		 */
+		typedef struct AT24CM0X_Transfer_t AT24CM0X_Transfer;
+	#endif
+	
+	           void at24cm0x_init(void);
+	
+	#ifdef AT24CM0X_MULTI_DEVICES
+		       void at24cm0x_device(unsigned char identifier);
+		AT24CM0X_Device* at24cm0x_device_handle(unsigned char identifier);
+	#endif
+	
+	#ifdef AT24CM0X_WP_CONTROL_EN
+		       void at24cm0x_wp(AT24CM0X_WP_Mode mode);
+	#endif
+	
+	#ifdef AT24CM0X_POWER_CONTROL_EN
+		       void at24cm0x_power(AT24CM0X_Power_Mode mode);
+		AT24CM0X_Status at24cm0x_power_down(void);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_SPEED_PROFILES
+		           void at24cm0x_speed_profile(AT24CM0X_Speed_Profile profile);
+		AT24CM0X_Speed_Profile at24cm0x_speed_current(void);
+	#endif
+	
+	AT24CM0X_Status at24cm0x_write_byte(unsigned long address, unsigned char data);
+	AT24CM0X_Status at24cm0x_write_page(unsigned int page, unsigned char *data, unsigned int size);
+	AT24CM0X_Status at24cm0x_write_page_offset(unsigned int page, unsigned int offset, const unsigned char *data, unsigned int size);
+	AT24CM0X_Status at24cm0x_write(unsigned long address, const unsigned char *data, unsigned long size);
+	AT24CM0X_Status at24cm0x_fill(unsigned long address, unsigned char value, unsigned long size);
+	AT24CM0X_Status at24cm0x_erase_all(void);
+	AT24CM0X_Status at24cm0x_read_current_byte(unsigned char *data);
+	AT24CM0X_Status at24cm0x_read_byte(unsigned long address, unsigned char *data);
+	AT24CM0X_Status at24cm0x_read_sequential(unsigned long address, unsigned char *data, unsigned int size);
+	
+	   unsigned int at24cm0x_crc16(unsigned int crc, const unsigned char *data, unsigned int size);
+	
+	           void at24cm0x_device_init(AT24CM0X_Device *device, unsigned char identifier);
+	AT24CM0X_Status at24cm0x_device_write_byte(AT24CM0X_Device *device, unsigned long address, unsigned char data);
+	AT24CM0X_Status at24cm0x_device_write_page(AT24CM0X_Device *device, unsigned int page, unsigned char *data, unsigned int size);
+	AT24CM0X_Status at24cm0x_device_write_page_offset(AT24CM0X_Device *device, unsigned int page, unsigned int offset, const unsigned char *data, unsigned int size);
+	AT24CM0X_Status at24cm0x_device_write(AT24CM0X_Device *device, unsigned long address, const unsigned char *data, unsigned long size);
+	AT24CM0X_Status at24cm0x_device_fill(AT24CM0X_Device *device, unsigned long address, unsigned char value, unsigned long size);
+	AT24CM0X_Status at24cm0x_device_erase_all(AT24CM0X_Device *device);
+	AT24CM0X_Status at24cm0x_device_read_current_byte(AT24CM0X_Device *device, unsigned char *data);
+	AT24CM0X_Status at24cm0x_device_read_byte(AT24CM0X_Device *device, unsigned long address, unsigned char *data);
+	AT24CM0X_Status at24cm0x_device_read_sequential(AT24CM0X_Device *device, unsigned long address, unsigned char *data, unsigned int size);
+	
+	#if defined(AT24CM0X_MULTI_DEVICES) && defined(AT24CM0X_WRITE_ACKNOWLEDGE_POLLING)
+		AT24CM0X_Status at24cm0x_write_parallel(AT24CM0X_Write_Job *jobs, unsigned char count);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_IMAGE
+		AT24CM0X_Status at24cm0x_program_image(AT24CM0X_Image_Callback producer, AT24CM0X_Image_Mode mode);
+		AT24CM0X_Status at24cm0x_dump(AT24CM0X_Image_Callback consumer);
+		AT24CM0X_Status at24cm0x_device_program_image(AT24CM0X_Device *device, AT24CM0X_Image_Callback producer, AT24CM0X_Image_Mode mode);
+		AT24CM0X_Status at24cm0x_device_dump(AT24CM0X_Device *device, AT24CM0X_Image_Callback consumer);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_BATCH
+		AT24CM0X_Status at24cm0x_batch(AT24CM0X_Transfer *transfers, unsigned char count);
+		AT24CM0X_Status at24cm0x_device_batch(AT24CM0X_Device *device, AT24CM0X_Transfer *transfers, unsigned char count);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_WRITE_CACHE
+		AT24CM0X_Status at24cm0x_flush(void);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_WRITE_QUEUE
+		AT24CM0X_Status at24cm0x_write_queue_flush(void);
+		AT24CM0X_Status at24cm0x_write_queue_task(void);
+	#endif
+	
+	#if defined(AT24CM0X_WRITE_ACKNOWLEDGE_POLLING) && defined(AT24CM0X_ENABLE_WRITE_CYCLE_STATISTICS)
+		           void at24cm0x_write_cycle_statistics(AT24CM0X_Write_Cycle_Statistics *statistics);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_INSTRUMENTATION
+		           void at24cm0x_instrumentation(AT24CM0X_Instrumentation *instrumentation);
+		           void at24cm0x_trace_begin(AT24CM0X_Trace trace, const AT24CM0X_Device *device, unsigned long address, unsigned int size, unsigned long timestamp);
+		           void at24cm0x_trace_end(AT24CM0X_Trace trace, const AT24CM0X_Device *device, AT24CM0X_Status status, unsigned long timestamp);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_CONDITIONAL_WRITE
+		           void at24cm0x_conditional_statistics(unsigned long *bytes, unsigned long *cycles);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_READ_CACHE
+		           void at24cm0x_read_cache_statistics(unsigned long *hits, unsigned long *misses);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_ADDRESS_TRACKING
+		AT24CM0X_Status at24cm0x_stream_open(unsigned long address);
+		AT24CM0X_Status at24cm0x_stream_read(unsigned char *data, unsigned int size);
+	#endif
+
+	#if defined(AT24CM0X_ENABLE_ASYNC_WRITE) || defined(AT24CM0X_ENABLE_WRITE_QUEUE) || defined(AT24CM0X_ENABLE_INSTRUMENTATION) || (defined(AT24CM0X_MULTI_DEVICES) && defined(AT24CM0X_WRITE_ACKNOWLEDGE_POLLING))
+		  unsigned long at24cm0x_timestamp(void);
+	#endif
+
+	#ifdef AT24CM0X_ENABLE_OS_HOOKS
+		           void at24cm0x_os_lock(void);
+		           void at24cm0x_os_unlock(void);
+		           void at24cm0x_os_sleep(unsigned int ms);
+		           void at24cm0x_os_yield(void);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_LOW_POWER
+		           void at24cm0x_power_sleep(unsigned int ms);
+	#endif
+	
+	#ifdef AT24CM0X_ENABLE_ASYNC_WRITE
+		AT24CM0X_Status at24cm0x_write_async(unsigned long address, const unsigned char *data, unsigned long size, AT24CM0X_Callback callback);
+		AT24CM0X_Status at24cm0x_read_async(unsigned long address, unsigned char *data, unsigned int size, AT24CM0X_Callback callback);
+		           void at24cm0x_task(void);
+		AT24CM0X_Status at24cm0x_async_status(void);
+	#endif
+	
+	/**
+	 * @brief Reads a 16-bit value (little endian) from the AT24CM0X EEPROM.
+	 * 
+	 * @details
+	 * This is a convenience wrapper that reads the bytes with @ref at24cm0x_read_sequential and assembles the value, so caching, read-ahead and integrity options apply as usual. The byte order matches the records of the log and key-value modules.
+	 * 
+	 * @param address EEPROM memory address of the first byte.
+	 * @param value   Pointer where the value will be stored.
+	 * 
+	 * @return AT24CM0X_Status Status of @ref at24cm0x_read_sequential. @p value is only written on @ref AT24CM0X_Status_Done.
+	 */
+	static inline AT24CM0X_Status at24cm0x_read_u16(unsigned long address, uint16_t *value)
+	{
+		unsigned char data[2];
+		
+		AT24CM0X_Status status = at24cm0x_read_sequential(address, data, sizeof(data));
+		
+		if(status == AT24CM0X_Status_Done)
+		{
+			*value = (uint16_t)(((uint16_t)data[0]) | ((uint16_t)data[1]<<8));
+		}
+		return status;
+	}
+	
+	/**
+	 * @brief Reads a 32-bit value (little endian) from the AT24CM0X EEPROM.
+	 * 
+	 * @param address EEPROM memory address of the first byte.
+	 * @param value   Pointer where the value will be stored.
+	 * 
+	 * @return AT24CM0X_Status Status of @ref at24cm0x_read_sequential.
+	 */
+	static inline AT24CM0X_Status at24cm0x_read_u32(unsigned long address, uint32_t *value)
+	{
+		unsigned char data[4];
+		
+		AT24CM0X_Status status = at24cm0x_read_sequential(address, data, sizeof(data));
+		
+		if(status == AT24CM0X_Status_Done)
+		{
+			*value = ((uint32_t)data[0]) | ((uint32_t)data[1]<<8) | ((uint32_t)data[2]<<16) | ((uint32_t)data[3]<<24);
+		}
+		return status;
+	}
+	
+	/**
+	 * @brief Writes a 16-bit value (little endian) to the AT24CM0X EEPROM.
+	 * 
+	 * @details
+	 * This is a convenience wrapper that serializes the value and passes it to @ref at24cm0x_write. Range checking and page handling are those of @ref at24cm0x_write, so a value that crosses a page boundary takes two write cycles.
+	 * 
+	 * @param address EEPROM memory address of the first byte.
+	 * @param value   Value to write.
+	 * 
+	 * @return AT24CM0X_Status Status of @ref at24cm0x_write.
+	 */
+	static inline AT24CM0X_Status at24cm0x_write_u16(unsigned long address, uint16_t value)
+	{
+		const unsigned char data[2] = { (unsigned char)(value), (unsigned char)(value>>8) };
+		
+		return at24cm0x_write(address, data, sizeof(data));
+	}
+	
+	/**
+	 * @brief Writes a 32-bit value (little endian) to the AT24CM0X EEPROM.
+	 * 
+	 * @param address EEPROM memory address of the first byte.
+	 * @param value   Value to write.
+	 * 
+	 * @return AT24CM0X_Status Status of @ref at24cm0x_write.
+	 */
+	static inline AT24CM0X_Status at24cm0x_write_u32(unsigned long address, uint32_t value)
+	{
+		const unsigned char data[4] = { (unsigned char)(value), (unsigned char)(value>>8), (unsigned char)(value>>16), (unsigned char)(value>>24) };
+		
+		return at24cm0x_write(address, data, sizeof(data));
+	}
+	
+	/**
+	 * @brief Reads a 32-bit float from the AT24CM0X EEPROM.
+	 * 
+	 * @details
+	 * The bit pattern of the float is stored like a value of @ref at24cm0x_read_u32.
+	 * 
+	 * @param address EEPROM memory address of the first byte.
+	 * @param value   Pointer where the value will be stored.
+	 * 
+	 * @return AT24CM0X_Status Status of @ref at24cm0x_read_sequential.
+	 */
+	static inline AT24CM0X_Status at24cm0x_read_float(unsigned long address, float *value)
+	{
+		union { uint32_t raw; float value; } data;
+		
+		AT24CM0X_Status status = at24cm0x_read_u32(address, &data.raw);
+		
+		if(status == AT24CM0X_Status_Done)
+		{
+			*value = data.value;
+		}
+		return status;
+	}
+	
+	/**
+	 * @brief Writes a 32-bit float to the AT24CM0X EEPROM.
+	 * 
+	 * @param address EEPROM memory address of the first byte.
+	 * @param value   Value to write.
+	 * 
+	 * @return AT24CM0X_Status Status of @ref at24cm0x_write.
+	 */
+	static inline AT24CM0X_Status at24cm0x_write_float(unsigned long address, float value)
+	{
+		union { uint32_t raw; float value; } data;
+		
+		data.value = value;
+		
+		return at24cm0x_write_u32(address, data.raw);
+	}
 
 #endif /* AT24CM0X_H_ */
\ No newline at end of file
@@ -0,0 +1,298 @@
+/**
+ * @file at24cm0x_ab.c
+ * 
+ * @brief Implementation of power-fail-safe A/B block storage on top of the AT24CM0X driver.
+ * 
+ * This file contains the implementation of a double-buffered block store. A new block is streamed into the inactive slot with page writes and is activated by a single header write that carries a sequence number and CRC16s. An interrupted update leaves the previous block intact, and after power up only the two slot headers are read to find the newest valid block.
+ * 
+ * @author g.raf
+ * @date 2026-01-25
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ * 
+ * @note This file is part of a larger project and subject to the license specified in the repository. For updates and the complete revision history, see the GitHub repository.
+ * 
+ * @see https://github.com/0x007e/drivers-prom-at24cm0x "AT24CM0X eeprom driver library"
+ */
+
+#include "at24cm0x_ab.h"
+
+static unsigned char at24cm0x_ab_target(AT24CM0X_AB *ab)
+{
+	return (ab->active == 0 ? 1 : 0);
+}
+
+static unsigned long at24cm0x_ab_data(AT24CM0X_AB *ab, unsigned char slot)
+{
+	return ab->address + (slot * ab->slot) + AT24CM0X_PAGE_SIZE;
+}
+
+/**
+ * @brief Opens an A/B block store and selects the newest valid block.
+ * 
+ * @details
+ * This function assigns the page range [@p page, @p page + @p pages - 1] of the given device to the store and splits it into two slots of equal size. The first page of each slot holds its header (sequence number, block size, CRC16 of the data and CRC16 of the header), the remaining pages hold the block data.
+ * 
+ * Only the two headers are read. A header whose CRC16 does not match is ignored, and of two valid headers the one with the higher sequence number is selected. Because a header is only written after its data, the selected slot always contains a completely written block. The data itself can be checked with @ref at24cm0x_ab_check.
+ * 
+ * @param ab     Pointer to the store structure that will be initialized.
+ * @param device Pointer to the device handle the store is located on.
+ * @param page   First page of the store region.
+ * @param pages  Number of pages of the store region; must be an even number of at least 4.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Page_Error if the region is invalid, otherwise the status of the header reads (@ref AT24CM0X_Status_Done also for an empty store).
+ */
+AT24CM0X_Status at24cm0x_ab_open(AT24CM0X_AB *ab, AT24CM0X_Device *device, unsigned int page, unsigned int pages)
+{
+	if(pages < 4 || (pages % 2) != 0 || ((unsigned long)page + pages) > (device->size >> AT24CM0X_PAGE_SHIFT))
+	{
+		return AT24CM0X_Status_Page_Error;
+	}
+	ab->device = device;
+	ab->address = (unsigned long)page << AT24CM0X_PAGE_SHIFT;
+	ab->slot = (unsigned long)(pages / 2) * AT24CM0X_PAGE_SIZE;
+	ab->capacity = ab->slot - AT24CM0X_PAGE_SIZE;
+	ab->active = AT24CM0X_AB_NONE;
+	ab->sequence = 0;
+	ab->size = 0;
+	ab->crc = 0;
+	ab->position = 0;
+	ab->update = 0xFFFF;
+	ab->pending = 0;
+	
+	for (unsigned char i=0; i < 2; i++)
+	{
+		unsigned char header[AT24CM0X_AB_HEADER_SIZE];
+		
+		AT24CM0X_Status status = at24cm0x_device_read_sequential(ab->device, (ab->address + (i * ab->slot)), header, AT24CM0X_AB_HEADER_SIZE);
+		
+		if(status != AT24CM0X_Status_Done)
+		{
+			return status;
+		}
+		
+		unsigned long sequence = ((unsigned long)header[0]) | ((unsigned long)header[1]<<8) | ((unsigned long)header[2]<<16) | ((unsigned long)header[3]<<24);
+		unsigned long size = ((unsigned long)header[4]) | ((unsigned long)header[5]<<8) | ((unsigned long)header[6]<<16) | ((unsigned long)header[7]<<24);
+		
+		if(at24cm0x_crc16(0xFFFF, header, 10) != (((unsigned int)header[10]) | ((unsigned int)header[11]<<8)) || size > ab->capacity)
+		{
+			continue;
+		}
+		
+		if(ab->active == AT24CM0X_AB_NONE || sequence > ab->sequence)
+		{
+			ab->active = i;
+			ab->sequence = sequence;
+			ab->size = size;
+			ab->crc = ((unsigned int)header[8]) | ((unsigned int)header[9]<<8);
+		}
+	}
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Starts a new block in the inactive slot.
+ * 
+ * @details
+ * This function resets the stream position and the running CRC16 of the block that is written with @ref at24cm0x_ab_stream. The active block is not touched and stays valid until @ref at24cm0x_ab_commit has succeeded.
+ * 
+ * @param ab Pointer to a store opened with @ref at24cm0x_ab_open.
+ */
+void at24cm0x_ab_begin(AT24CM0X_AB *ab)
+{
+	ab->position = 0;
+	ab->update = 0xFFFF;
+	ab->pending = 1;
+}
+
+/**
+ * @brief Appends data to the new block in the inactive slot.
+ * 
+ * @details
+ * This function writes @p size bytes behind the previously streamed data of the new block and updates its running CRC16. The data is written with @ref at24cm0x_device_write, so it is split at page boundaries and every page is programmed with a single write cycle. Streaming in multiples of @ref AT24CM0X_PAGE_SIZE keeps every write a full page write.
+ * 
+ * @param ab   Pointer to a store on which @ref at24cm0x_ab_begin has been called.
+ * @param data Pointer to the data to be appended.
+ * @param size Number of bytes to append; must be greater than 0.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Size_Error if the block would exceed `ab->capacity`, otherwise the status of the write.
+ */
+AT24CM0X_Status at24cm0x_ab_stream(AT24CM0X_AB *ab, const unsigned char *data, unsigned long size)
+{
+	if(size == 0 || size > (ab->capacity - ab->position))
+	{
+		return AT24CM0X_Status_Size_Error;
+	}
+	
+	AT24CM0X_Status status = at24cm0x_device_write(ab->device, (at24cm0x_ab_data(ab, at24cm0x_ab_target(ab)) + ab->position), data, size);
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		return status;
+	}
+	
+	ab->pending = 1;
+	
+	while(size > 0)
+	{
+		unsigned int chunk = (size > 0x8000UL ? 0x8000U : (unsigned int)size);
+		
+		ab->update = at24cm0x_crc16(ab->update, data, chunk);
+		
+		data += chunk;
+		size -= chunk;
+		ab->position += chunk;
+	}
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Activates the new block.
+ * 
+ * @details
+ * This function writes the header of the inactive slot with the next sequence number, the streamed size and the CRC16s. The header is stored with a single write cycle and the slot becomes the active one. If power is lost before the header is completely written, its CRC16 does not match and the previous block stays active after @ref at24cm0x_ab_open. With @ref AT24CM0X_ENABLE_WRITE_CACHE or @ref AT24CM0X_ENABLE_WRITE_QUEUE the pending data is flushed before and the header after it is written, so the order of data and header on the device is kept.
+ * 
+ * After a successful commit the stream state is cleared. A further commit is only accepted after @ref at24cm0x_ab_begin or @ref at24cm0x_ab_stream, otherwise it would activate the stale data of the other slot.
+ * 
+ * @param ab Pointer to a store into which the new block has been streamed.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Data_Error if no new block has been begun or streamed since the last commit, otherwise the status of the header write.
+ */
+AT24CM0X_Status at24cm0x_ab_commit(AT24CM0X_AB *ab)
+{
+	unsigned char header[AT24CM0X_AB_HEADER_SIZE];
+	unsigned char target = at24cm0x_ab_target(ab);
+	unsigned long sequence = (ab->active == AT24CM0X_AB_NONE ? 0 : ab->sequence + 1);
+	
+	if(!ab->pending)
+	{
+		return AT24CM0X_Status_Data_Error;
+	}
+	
+	#if defined(AT24CM0X_ENABLE_WRITE_CACHE)
+		AT24CM0X_Status status = at24cm0x_flush();
+	#elif defined(AT24CM0X_ENABLE_WRITE_QUEUE)
+		AT24CM0X_Status status = at24cm0x_write_queue_flush();
+	#else
+		AT24CM0X_Status status = AT24CM0X_Status_Done;
+	#endif
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		return status;
+	}
+	
+	header[0] = (unsigned char)(sequence);
+	header[1] = (unsigned char)(sequence>>8);
+	header[2] = (unsigned char)(sequence>>16);
+	header[3] = (unsigned char)(sequence>>24);
+	header[4] = (unsigned char)(ab->position);
+	header[5] = (unsigned char)(ab->position>>8);
+	header[6] = (unsigned char)(ab->position>>16);
+	header[7] = (unsigned char)(ab->position>>24);
+	header[8] = (unsigned char)(ab->update);
+	header[9] = (unsigned char)(ab->update>>8);
+	
+	unsigned int crc = at24cm0x_crc16(0xFFFF, header, 10);
+	
+	header[10] = (unsigned char)(crc);
+	header[11] = (unsigned char)(crc>>8);
+	
+	status = at24cm0x_device_write(ab->device, (ab->address + (target * ab->slot)), header, AT24CM0X_AB_HEADER_SIZE);
+	
+	#if defined(AT24CM0X_ENABLE_WRITE_CACHE)
+		if(status == AT24CM0X_Status_Done)
+		{
+			status = at24cm0x_flush();
+		}
+	#elif defined(AT24CM0X_ENABLE_WRITE_QUEUE)
+		if(status == AT24CM0X_Status_Done)
+		{
+			status = at24cm0x_write_queue_flush();
+		}
+	#endif
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		return status;
+	}
+	ab->active = target;
+	ab->sequence = sequence;
+	ab->size = ab->position;
+	ab->crc = ab->update;
+	ab->position = 0;
+	ab->update = 0xFFFF;
+	ab->pending = 0;
+	
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Reads data of the active block.
+ * 
+ * @param ab     Pointer to a store opened with @ref at24cm0x_ab_open.
+ * @param offset Offset of the first byte within the block.
+ * @param data   Pointer to the buffer where the data will be stored.
+ * @param size   Number of bytes to read; must be greater than 0.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Address_Error if no block is active, @ref AT24CM0X_Status_Size_Error if the range exceeds the block, otherwise the status of the read.
+ */
+AT24CM0X_Status at24cm0x_ab_read(AT24CM0X_AB *ab, unsigned long offset, unsigned char *data, unsigned int size)
+{
+	if(ab->active == AT24CM0X_AB_NONE)
+	{
+		return AT24CM0X_Status_Address_Error;
+	}
+	
+	if(size == 0 || offset > ab->size || size > (ab->size - offset))
+	{
+		return AT24CM0X_Status_Size_Error;
+	}
+	return at24cm0x_device_read_sequential(ab->device, (at24cm0x_ab_data(ab, ab->active) + offset), data, size);
+}
+
+/**
+ * @brief Checks the data of the active block against its CRC16.
+ * 
+ * @details
+ * This function reads the complete block in pieces of @ref AT24CM0X_AB_CHECK_BUFFER_SIZE bytes and compares its CRC16 with the value stored in the header. It is only required if the data may have been corrupted after it was committed, because @ref at24cm0x_ab_open already guarantees that the active block was completely written.
+ * 
+ * @param ab Pointer to a store opened with @ref at24cm0x_ab_open.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Address_Error if no block is active, @ref AT24CM0X_Status_Data_Error on a CRC16 mismatch, otherwise the status of the reads.
+ */
+AT24CM0X_Status at24cm0x_ab_check(AT24CM0X_AB *ab)
+{
+	if(ab->active == AT24CM0X_AB_NONE)
+	{
+		return AT24CM0X_Status_Address_Error;
+	}
+	
+	unsigned char buffer[AT24CM0X_AB_CHECK_BUFFER_SIZE];
+	unsigned int crc = 0xFFFF;
+	
+	for (unsigned long i=0; i < ab->size; i += AT24CM0X_AB_CHECK_BUFFER_SIZE)
+	{
+		unsigned int size = AT24CM0X_AB_CHECK_BUFFER_SIZE;
+		
+		if(size > (ab->size - i))
+		{
+			size = (unsigned int)(ab->size - i);
+		}
+		AT24CM0X_Status status = at24cm0x_device_read_sequential(ab->device, (at24cm0x_ab_data(ab, ab->active) + i), buffer, size);
+		
+		if(status != AT24CM0X_Status_Done)
+		{
+			return status;
+		}
+		crc = at24cm0x_crc16(crc, buffer, size);
+	}
+	
+	if(crc != ab->crc)
+	{
+		return AT24CM0X_Status_Data_Error;
+	}
+	return AT24CM0X_Status_Done;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file at24cm0x_ab.h
+ * @brief Header file with declarations and macros for power-fail-safe A/B block storage on an at24cm0x.
+ * 
+ * This file provides function prototypes, type definitions, and constants for a double-buffered block store with two slots that is built on top of the at24cm0x driver.
+ * 
+ * @author g.raf
+ * @date 2026-01-24
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ * 
+ * @note This file is part of a larger project and subject to the license specified in the repository. For updates and the complete revision history, see the GitHub repository.
+ * 
+ * @see https://github.com/0x007e/drivers-prom-at24cm0x "AT24CM0X eeprom driver library"
+ */
+
+#ifndef AT24CM0X_AB_H_
+#define AT24CM0X_AB_H_
+
+	#ifndef AT24CM0X_AB_CHECK_BUFFER_SIZE
+		/**
+		 * @def AT24CM0X_AB_CHECK_BUFFER_SIZE
+		 * @brief Size of the temporary buffer used by @ref at24cm0x_ab_check in bytes.
+		 * 
+		 *  The data of the active slot is read back in blocks of this size to calculate its CRC16. The buffer is placed on the stack.
+		 * 
+		 * @note The default value `32UL` keeps the stack usage low. Larger values reduce the number of read transfers.
+		 */
+		#define AT24CM0X_AB_CHECK_BUFFER_SIZE 32UL
+	#endif
+	
+	/**
+	 * @def AT24CM0X_AB_HEADER_SIZE
+	 * @brief Size of the header in the first page of every slot in bytes.
+	 */
+	#define AT24CM0X_AB_HEADER_SIZE 12UL
+	
+	/**
+	 * @def AT24CM0X_AB_NONE
+	 * @brief Value of `active` if no slot holds a valid block.
+	 */
+	#define AT24CM0X_AB_NONE 0xFF
+	
+	#include "at24cm0x.h"
+	
+	/**
+	 * @struct AT24CM0X_AB_t
+	 * @brief State of an A/B block store.
+	 * 
+	 * @details
+	 * The structure is filled by @ref at24cm0x_ab_open and updated by @ref at24cm0x_ab_begin, @ref at24cm0x_ab_stream and @ref at24cm0x_ab_commit. All members are managed by the A/B module and should only be read by the application.
+	 */
+	struct AT24CM0X_AB_t
+	{
+		AT24CM0X_Device *device;   /**< Device handle the store is located on. */
+		unsigned long address;     /**< Start address of slot A. */
+		unsigned long slot;        /**< Size of a slot including its header page in bytes. */
+		unsigned long capacity;    /**< Maximum size of a block in bytes. */
+		unsigned char active;      /**< Slot holding the newest valid block (0 or 1), @ref AT24CM0X_AB_NONE if none. */
+		unsigned long sequence;    /**< Sequence number of the active block. */
+		unsigned long size;        /**< Size of the active block in bytes. */
+		unsigned int crc;          /**< CRC16 of the data of the active block. */
+		unsigned long position;    /**< Number of bytes streamed into the inactive slot since @ref at24cm0x_ab_begin or the last commit. */
+		unsigned int update;       /**< Running CRC16 of the streamed data. */
+		unsigned char pending;     /**< Set once a new block has been begun or streamed, cleared by @ref at24cm0x_ab_commit. */
+	};
+	/**
+	 * @typedef AT24CM0X_AB
+	 * @brief Alias for struct AT24CM0X_AB_t.
+	 */
+	typedef struct AT24CM0X_AB_t AT24CM0X_AB;
+	
+	AT24CM0X_Status at24cm0x_ab_open(AT24CM0X_AB *ab, AT24CM0X_Device *device, unsigned int page, unsigned int pages);
+	           void at24cm0x_ab_begin(AT24CM0X_AB *ab);
+	AT24CM0X_Status at24cm0x_ab_stream(AT24CM0X_AB *ab, const unsigned char *data, unsigned long size);
+	AT24CM0X_Status at24cm0x_ab_commit(AT24CM0X_AB *ab);
+	AT24CM0X_Status at24cm0x_ab_read(AT24CM0X_AB *ab, unsigned long offset, unsigned char *data, unsigned int size);
+	AT24CM0X_Status at24cm0x_ab_check(AT24CM0X_AB *ab);
+
+#endif /* AT24CM0X_AB_H_ */
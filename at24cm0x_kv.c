@@ -0,0 +1,434 @@
+/**
+ * @file at24cm0x_kv.c
+ * 
+ * @brief Implementation of a key-value parameter store on top of the AT24CM0X driver.
+ * 
+ * This file contains the implementation of a key-value store with a hashed index. The index is stored in reserved pages at the start of the store region and is held in RAM, so a lookup costs a single sequential read of the value slot. Updates are written to a free slot first and only then the index entry is changed, so values are never read-modify-written.
+ * 
+ * @author g.raf
+ * @date 2026-01-25
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ * 
+ * @note This file is part of a larger project and subject to the license specified in the repository. For updates and the complete revision history, see the GitHub repository.
+ * 
+ * @see https://github.com/0x007e/drivers-prom-at24cm0x "AT24CM0X eeprom driver library"
+ */
+
+#include "at24cm0x_kv.h"
+
+#define AT24CM0X_KV_KEY_EMPTY 0xFFFF
+#define AT24CM0X_KV_KEY_DELETED 0xFFFE
+
+static unsigned int at24cm0x_kv_find(AT24CM0X_KV *kv, unsigned int key)
+{
+	for (unsigned int i=0; i < AT24CM0X_KV_KEYS; i++)
+	{
+		unsigned int position = (key + i) % AT24CM0X_KV_KEYS;
+		
+		if(kv->keys[position] == key)
+		{
+			return position;
+		}
+		
+		if(kv->keys[position] == AT24CM0X_KV_KEY_EMPTY)
+		{
+			break;
+		}
+	}
+	return AT24CM0X_KV_KEYS;
+}
+
+static unsigned int at24cm0x_kv_place(AT24CM0X_KV *kv, unsigned int key)
+{
+	for (unsigned int i=0; i < AT24CM0X_KV_KEYS; i++)
+	{
+		unsigned int position = (key + i) % AT24CM0X_KV_KEYS;
+		
+		if(kv->keys[position] == AT24CM0X_KV_KEY_EMPTY || kv->keys[position] == AT24CM0X_KV_KEY_DELETED)
+		{
+			return position;
+		}
+	}
+	return AT24CM0X_KV_KEYS;
+}
+
+static unsigned char at24cm0x_kv_used(AT24CM0X_KV *kv, unsigned int slot)
+{
+	for (unsigned int i=0; i < AT24CM0X_KV_KEYS; i++)
+	{
+		if(kv->keys[i] < AT24CM0X_KV_KEY_DELETED && kv->entries[i] == slot)
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static AT24CM0X_Status at24cm0x_kv_entry(AT24CM0X_KV *kv, unsigned int position)
+{
+	unsigned char entry[4];
+	
+	entry[0] = (unsigned char)(kv->keys[position]);
+	entry[1] = (unsigned char)(kv->keys[position]>>8);
+	entry[2] = (unsigned char)(kv->entries[position]);
+	entry[3] = (unsigned char)(kv->entries[position]>>8);
+	
+	return at24cm0x_device_write(kv->device, (kv->address + (position * 4UL)), entry, sizeof(entry));
+}
+
+static AT24CM0X_Status at24cm0x_kv_flush(void)
+{
+	#if defined(AT24CM0X_ENABLE_WRITE_CACHE)
+		return at24cm0x_flush();
+	#elif defined(AT24CM0X_ENABLE_WRITE_QUEUE)
+		return at24cm0x_write_queue_flush();
+	#else
+		return AT24CM0X_Status_Done;
+	#endif
+}
+
+/**
+ * @brief Opens a key-value store and loads its index.
+ * 
+ * @details
+ * This function assigns the page range [@p page, @p page + @p pages - 1] of the given device to the store. The first @ref AT24CM0X_KV_INDEX_PAGES pages hold the index, the remaining pages are divided into value slots of @ref AT24CM0X_KV_SLOT_SIZE bytes.
+ * 
+ * The index is read into RAM once. For every entry the header of the referenced slot is checked, so entries whose slot does not belong to the key (e.g. after a power loss during an index update) are dropped. Afterwards @ref at24cm0x_kv_get needs no further index access on the device.
+ * 
+ * @note A region that contains data of a different use must be cleared once with @ref at24cm0x_kv_format.
+ * 
+ * @param kv     Pointer to the store structure that will be initialized.
+ * @param device Pointer to the device handle the store is located on.
+ * @param page   First page of the store region.
+ * @param pages  Number of pages of the store region; the value slots must exceed @ref AT24CM0X_KV_KEYS.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Page_Error if the region does not fit, otherwise the status of the index read.
+ */
+AT24CM0X_Status at24cm0x_kv_open(AT24CM0X_KV *kv, AT24CM0X_Device *device, unsigned int page, unsigned int pages)
+{
+	if(pages <= AT24CM0X_KV_INDEX_PAGES || ((unsigned long)page + pages) > (device->size >> AT24CM0X_PAGE_SHIFT))
+	{
+		return AT24CM0X_Status_Page_Error;
+	}
+	
+	unsigned long slots = (pages - AT24CM0X_KV_INDEX_PAGES) * (AT24CM0X_PAGE_SIZE / AT24CM0X_KV_SLOT_SIZE);
+	
+	if(slots <= AT24CM0X_KV_KEYS)
+	{
+		return AT24CM0X_Status_Page_Error;
+	}
+	
+	if(slots > AT24CM0X_KV_KEY_DELETED)
+	{
+		slots = AT24CM0X_KV_KEY_DELETED;
+	}
+	kv->device = device;
+	kv->address = (unsigned long)page << AT24CM0X_PAGE_SHIFT;
+	kv->data = kv->address + (AT24CM0X_KV_INDEX_PAGES * AT24CM0X_PAGE_SIZE);
+	kv->slots = (unsigned int)slots;
+	kv->next = 0;
+	kv->sequence = 0;
+	
+	unsigned char buffer[AT24CM0X_KV_SLOT_SIZE];
+	
+	for (unsigned int i=0; i < AT24CM0X_KV_KEYS; i++)
+	{
+		if((i % (AT24CM0X_KV_SLOT_SIZE / 4)) == 0)
+		{
+			unsigned int size = (AT24CM0X_KV_KEYS - i) * 4;
+			
+			if(size > AT24CM0X_KV_SLOT_SIZE)
+			{
+				size = AT24CM0X_KV_SLOT_SIZE;
+			}
+			AT24CM0X_Status status = at24cm0x_device_read_sequential(kv->device, (kv->address + (i * 4UL)), buffer, size);
+			
+			if(status != AT24CM0X_Status_Done)
+			{
+				return status;
+			}
+		}
+		unsigned char *entry = &buffer[(i % (AT24CM0X_KV_SLOT_SIZE / 4)) * 4];
+		
+		kv->keys[i] = ((unsigned int)entry[0]) | ((unsigned int)entry[1]<<8);
+		kv->entries[i] = ((unsigned int)entry[2]) | ((unsigned int)entry[3]<<8);
+		
+		if(kv->keys[i] < AT24CM0X_KV_KEY_DELETED && kv->entries[i] >= kv->slots)
+		{
+			kv->keys[i] = AT24CM0X_KV_KEY_DELETED;
+		}
+	}
+	
+	for (unsigned int i=0; i < AT24CM0X_KV_KEYS; i++)
+	{
+		if(kv->keys[i] >= AT24CM0X_KV_KEY_DELETED)
+		{
+			continue;
+		}
+		
+		AT24CM0X_Status status = at24cm0x_device_read_sequential(kv->device, (kv->data + ((unsigned long)kv->entries[i] * AT24CM0X_KV_SLOT_SIZE)), buffer, AT24CM0X_KV_HEADER_SIZE);
+		
+		if(status != AT24CM0X_Status_Done)
+		{
+			return status;
+		}
+		
+		unsigned int key = ((unsigned int)buffer[0]) | ((unsigned int)buffer[1]<<8);
+		unsigned long sequence = ((unsigned long)buffer[4]) | ((unsigned long)buffer[5]<<8) | ((unsigned long)buffer[6]<<16) | ((unsigned long)buffer[7]<<24);
+		
+		if(key != kv->keys[i])
+		{
+			kv->keys[i] = AT24CM0X_KV_KEY_DELETED;
+			continue;
+		}
+		
+		if(sequence >= kv->sequence)
+		{
+			kv->sequence = sequence + 1;
+			kv->next = (kv->entries[i] + 1) % kv->slots;
+		}
+	}
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Removes all keys of the key-value store.
+ * 
+ * @details
+ * This function erases the index of the store on the device (all bytes `0xFF`) and clears the RAM copy. The value slots are not touched, they are overwritten by later updates.
+ * 
+ * @param kv Pointer to a store opened with @ref at24cm0x_kv_open.
+ * 
+ * @return AT24CM0X_Status Status of the first failing write, or @ref AT24CM0X_Status_Done.
+ */
+AT24CM0X_Status at24cm0x_kv_format(AT24CM0X_KV *kv)
+{
+	unsigned char buffer[AT24CM0X_KV_SLOT_SIZE];
+	
+	for (unsigned int i=0; i < AT24CM0X_KV_SLOT_SIZE; i++)
+	{
+		buffer[i] = 0xFF;
+	}
+	
+	for (unsigned long i=0; i < (AT24CM0X_KV_KEYS * 4UL); i += AT24CM0X_KV_SLOT_SIZE)
+	{
+		unsigned int size = AT24CM0X_KV_SLOT_SIZE;
+		
+		if(size > ((AT24CM0X_KV_KEYS * 4UL) - i))
+		{
+			size = (unsigned int)((AT24CM0X_KV_KEYS * 4UL) - i);
+		}
+		AT24CM0X_Status status = at24cm0x_device_write(kv->device, (kv->address + i), buffer, size);
+		
+		if(status != AT24CM0X_Status_Done)
+		{
+			return status;
+		}
+	}
+	
+	for (unsigned int i=0; i < AT24CM0X_KV_KEYS; i++)
+	{
+		kv->keys[i] = AT24CM0X_KV_KEY_EMPTY;
+		kv->entries[i] = AT24CM0X_KV_KEY_EMPTY;
+	}
+	kv->next = 0;
+	kv->sequence = 0;
+	
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Reads the value of a key.
+ * 
+ * @details
+ * This function looks up the key in the RAM copy of the index and reads the referenced value slot with a single @ref at24cm0x_device_read_sequential. The key and the CRC16 stored in the slot header are checked before the value is returned.
+ * 
+ * @param kv     Pointer to a store opened with @ref at24cm0x_kv_open.
+ * @param key    Key of the value, in the range [0, 65533].
+ * @param data   Pointer to the buffer where the value will be stored.
+ * @param size   Size of the buffer in bytes.
+ * @param length Pointer where the length of the value will be stored.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Address_Error if the key does not exist, @ref AT24CM0X_Status_Size_Error if the buffer is too small, @ref AT24CM0X_Status_Data_Error if the slot is corrupted, otherwise the status of the read.
+ */
+AT24CM0X_Status at24cm0x_kv_get(AT24CM0X_KV *kv, unsigned int key, unsigned char *data, unsigned int size, unsigned int *length)
+{
+	unsigned int position = at24cm0x_kv_find(kv, key);
+	
+	if(key >= AT24CM0X_KV_KEY_DELETED || position == AT24CM0X_KV_KEYS)
+	{
+		return AT24CM0X_Status_Address_Error;
+	}
+	
+	unsigned char slot[AT24CM0X_KV_SLOT_SIZE];
+	
+	AT24CM0X_Status status = at24cm0x_device_read_sequential(kv->device, (kv->data + ((unsigned long)kv->entries[position] * AT24CM0X_KV_SLOT_SIZE)), slot, AT24CM0X_KV_SLOT_SIZE);
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		return status;
+	}
+	
+	unsigned int stored = ((unsigned int)slot[0]) | ((unsigned int)slot[1]<<8);
+	unsigned int count = ((unsigned int)slot[2]) | ((unsigned int)slot[3]<<8);
+	
+	if(stored != key || count == 0 || count > AT24CM0X_KV_VALUE_SIZE)
+	{
+		return AT24CM0X_Status_Data_Error;
+	}
+	
+	unsigned int crc = at24cm0x_crc16(at24cm0x_crc16(0xFFFF, slot, 8), &slot[AT24CM0X_KV_HEADER_SIZE], count);
+	
+	if(crc != (((unsigned int)slot[8]) | ((unsigned int)slot[9]<<8)))
+	{
+		return AT24CM0X_Status_Data_Error;
+	}
+	
+	if(count > size)
+	{
+		return AT24CM0X_Status_Size_Error;
+	}
+	
+	for (unsigned int i=0; i < count; i++)
+	{
+		*(data + i) = slot[AT24CM0X_KV_HEADER_SIZE + i];
+	}
+	*length = count;
+	
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Writes the value of a key.
+ * 
+ * @details
+ * This function writes the value together with the key, its length, a sequence number and a CRC16 into a free value slot. The search for a free slot continues behind the previously written slot, so the value writes rotate through all slots. Only after the slot has been written, the index entry is updated on the device and in RAM. If the update is interrupted, the previous value of the key stays valid. With @ref AT24CM0X_ENABLE_WRITE_CACHE or @ref AT24CM0X_ENABLE_WRITE_QUEUE the pending data is flushed before and the index entry after it is written, so the order of slot and index entry on the device is kept.
+ * 
+ * @note The index entry is rewritten in place, so every update and every @ref at24cm0x_kv_erase costs one write cycle of the index page of the key. The index pages wear out long before the value slots: the store endures about as many updates in total as a single page endures write cycles.
+ * 
+ * @param kv   Pointer to a store opened with @ref at24cm0x_kv_open.
+ * @param key  Key of the value, in the range [0, 65533].
+ * @param data Pointer to the value.
+ * @param size Number of bytes of the value; must be greater than 0 and not larger than @ref AT24CM0X_KV_VALUE_SIZE.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Address_Error for an invalid key, @ref AT24CM0X_Status_Size_Error for an invalid size or if the index is full, otherwise the status of the writes.
+ */
+AT24CM0X_Status at24cm0x_kv_set(AT24CM0X_KV *kv, unsigned int key, const unsigned char *data, unsigned int size)
+{
+	if(key >= AT24CM0X_KV_KEY_DELETED)
+	{
+		return AT24CM0X_Status_Address_Error;
+	}
+	
+	if(size == 0 || size > AT24CM0X_KV_VALUE_SIZE)
+	{
+		return AT24CM0X_Status_Size_Error;
+	}
+	
+	unsigned int position = at24cm0x_kv_find(kv, key);
+	
+	if(position == AT24CM0X_KV_KEYS)
+	{
+		position = at24cm0x_kv_place(kv, key);
+		
+		if(position == AT24CM0X_KV_KEYS)
+		{
+			return AT24CM0X_Status_Size_Error;
+		}
+	}
+	
+	unsigned int target = kv->next;
+	
+	while(at24cm0x_kv_used(kv, target))
+	{
+		target = (target + 1) % kv->slots;
+	}
+	
+	unsigned char slot[AT24CM0X_KV_SLOT_SIZE];
+	
+	slot[0] = (unsigned char)(key);
+	slot[1] = (unsigned char)(key>>8);
+	slot[2] = (unsigned char)(size);
+	slot[3] = (unsigned char)(size>>8);
+	slot[4] = (unsigned char)(kv->sequence);
+	slot[5] = (unsigned char)(kv->sequence>>8);
+	slot[6] = (unsigned char)(kv->sequence>>16);
+	slot[7] = (unsigned char)(kv->sequence>>24);
+	
+	for (unsigned int i=0; i < size; i++)
+	{
+		slot[AT24CM0X_KV_HEADER_SIZE + i] = *(data + i);
+	}
+	
+	unsigned int crc = at24cm0x_crc16(at24cm0x_crc16(0xFFFF, slot, 8), data, size);
+	
+	slot[8] = (unsigned char)(crc);
+	slot[9] = (unsigned char)(crc>>8);
+	
+	AT24CM0X_Status status = at24cm0x_device_write(kv->device, (kv->data + ((unsigned long)target * AT24CM0X_KV_SLOT_SIZE)), slot, (AT24CM0X_KV_HEADER_SIZE + size));
+	
+	if(status == AT24CM0X_Status_Done)
+	{
+		status = at24cm0x_kv_flush();
+	}
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		return status;
+	}
+	kv->next = (target + 1) % kv->slots;
+	kv->sequence++;
+	
+	unsigned int previous_key = kv->keys[position];
+	unsigned int previous_entry = kv->entries[position];
+	
+	kv->keys[position] = key;
+	kv->entries[position] = target;
+	
+	status = at24cm0x_kv_entry(kv, position);
+	
+	if(status == AT24CM0X_Status_Done)
+	{
+		status = at24cm0x_kv_flush();
+	}
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		kv->keys[position] = previous_key;
+		kv->entries[position] = previous_entry;
+	}
+	return status;
+}
+
+/**
+ * @brief Removes a key from the key-value store.
+ * 
+ * @details
+ * This function marks the index entry of the key as deleted on the device and in RAM. The slot of the value becomes free for later updates.
+ * 
+ * @param kv  Pointer to a store opened with @ref at24cm0x_kv_open.
+ * @param key Key that will be removed.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Address_Error if the key does not exist, otherwise the status of the write.
+ */
+AT24CM0X_Status at24cm0x_kv_erase(AT24CM0X_KV *kv, unsigned int key)
+{
+	unsigned int position = at24cm0x_kv_find(kv, key);
+	
+	if(key >= AT24CM0X_KV_KEY_DELETED || position == AT24CM0X_KV_KEYS)
+	{
+		return AT24CM0X_Status_Address_Error;
+	}
+	kv->keys[position] = AT24CM0X_KV_KEY_DELETED;
+	
+	AT24CM0X_Status status = at24cm0x_kv_entry(kv, position);
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		kv->keys[position] = key;
+	}
+	return status;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file at24cm0x_kv.h
+ * @brief Header file with declarations and macros for a key-value parameter store on an at24cm0x.
+ * 
+ * This file provides function prototypes, type definitions, and constants for a key-value store with a hashed index that is built on top of the at24cm0x driver.
+ * 
+ * @author g.raf
+ * @date 2026-01-24
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ * 
+ * @note This file is part of a larger project and subject to the license specified in the repository. For updates and the complete revision history, see the GitHub repository.
+ * 
+ * @see https://github.com/0x007e/drivers-prom-at24cm0x "AT24CM0X eeprom driver library"
+ */
+
+#ifndef AT24CM0X_KV_H_
+#define AT24CM0X_KV_H_
+
+	#ifndef AT24CM0X_KV_KEYS
+		/**
+		 * @def AT24CM0X_KV_KEYS
+		 * @brief Maximum number of keys of the key-value store.
+		 * 
+		 *  This macro defines the number of entries of the hashed index. The index is stored in the first pages of the store region and is held in RAM after @ref at24cm0x_kv_open, where every entry needs 4 bytes.
+		 * 
+		 * @note The default value `32` allows 32 keys. Lookups stay fast as long as the store is not filled completely.
+		 */
+		#define AT24CM0X_KV_KEYS 32
+	#endif
+	
+	#ifndef AT24CM0X_KV_SLOT_SIZE
+		/**
+		 * @def AT24CM0X_KV_SLOT_SIZE
+		 * @brief Size of a single value slot of the key-value store in bytes.
+		 * 
+		 *  Every value is stored in its own slot behind the index. A slot starts with a header of @ref AT24CM0X_KV_HEADER_SIZE bytes (key, length, sequence number and CRC16), the remaining bytes are available for the value.
+		 * 
+		 * @note The default value `32UL` allows values of up to 22 bytes. The value has to be a divider of @ref AT24CM0X_PAGE_SIZE. A temporary buffer of this size is placed on the stack during @ref at24cm0x_kv_get and @ref at24cm0x_kv_set.
+		 */
+		#define AT24CM0X_KV_SLOT_SIZE 32UL
+	#endif
+	
+	/**
+	 * @def AT24CM0X_KV_HEADER_SIZE
+	 * @brief Size of the header at the start of every slot in bytes.
+	 */
+	#define AT24CM0X_KV_HEADER_SIZE 10UL
+	
+	/**
+	 * @def AT24CM0X_KV_VALUE_SIZE
+	 * @brief Maximum number of bytes of a single value.
+	 */
+	#define AT24CM0X_KV_VALUE_SIZE (AT24CM0X_KV_SLOT_SIZE - AT24CM0X_KV_HEADER_SIZE)
+	
+	/**
+	 * @def AT24CM0X_KV_INDEX_PAGES
+	 * @brief Number of pages at the start of the store region that are reserved for the index.
+	 */
+	#define AT24CM0X_KV_INDEX_PAGES (((AT24CM0X_KV_KEYS * 4UL) + AT24CM0X_PAGE_SIZE - 1) / AT24CM0X_PAGE_SIZE)
+	
+	#include "at24cm0x.h"
+	
+	#if (AT24CM0X_PAGE_SIZE % AT24CM0X_KV_SLOT_SIZE) != 0 || AT24CM0X_KV_SLOT_SIZE <= AT24CM0X_KV_HEADER_SIZE
+		#error "AT24CM0X_KV_SLOT_SIZE must be a divider of AT24CM0X_PAGE_SIZE and larger than AT24CM0X_KV_HEADER_SIZE!"
+	#endif
+	
+	#if AT24CM0X_KV_KEYS < 1 || AT24CM0X_KV_KEYS > 0xFFFD
+		#error "AT24CM0X_KV_KEYS must be in the range [1, 65533]!"
+	#endif
+	
+	/**
+	 * @struct AT24CM0X_KV_t
+	 * @brief State of a key-value store.
+	 * 
+	 * @details
+	 * The structure is filled by @ref at24cm0x_kv_open and holds the RAM copy of the index. All members are managed by the key-value module and should only be read by the application.
+	 */
+	struct AT24CM0X_KV_t
+	{
+		AT24CM0X_Device *device;                 /**< Device handle the store is located on. */
+		unsigned long address;                   /**< Start address of the index. */
+		unsigned long data;                      /**< Start address of the first value slot. */
+		unsigned int slots;                      /**< Number of value slots. */
+		unsigned int next;                       /**< Slot where the search for a free slot starts. */
+		unsigned long sequence;                  /**< Sequence number of the next written value. */
+		unsigned int keys[AT24CM0X_KV_KEYS];     /**< Keys of the index entries. */
+		unsigned int entries[AT24CM0X_KV_KEYS];  /**< Value slots of the index entries. */
+	};
+	/**
+	 * @typedef AT24CM0X_KV
+	 * @brief Alias for struct AT24CM0X_KV_t.
+	 */
+	typedef struct AT24CM0X_KV_t AT24CM0X_KV;
+	
+	AT24CM0X_Status at24cm0x_kv_open(AT24CM0X_KV *kv, AT24CM0X_Device *device, unsigned int page, unsigned int pages);
+	AT24CM0X_Status at24cm0x_kv_format(AT24CM0X_KV *kv);
+	AT24CM0X_Status at24cm0x_kv_get(AT24CM0X_KV *kv, unsigned int key, unsigned char *data, unsigned int size, unsigned int *length);
+	AT24CM0X_Status at24cm0x_kv_set(AT24CM0X_KV *kv, unsigned int key, const unsigned char *data, unsigned int size);
+	AT24CM0X_Status at24cm0x_kv_erase(AT24CM0X_KV *kv, unsigned int key);
+
+#endif /* AT24CM0X_KV_H_ */
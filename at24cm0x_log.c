@@ -0,0 +1,307 @@
+/**
+ * @file at24cm0x_log.c
+ * 
+ * @brief Implementation of a circular record log on top of the AT24CM0X driver.
+ * 
+ * This file contains the implementation of a log-structured record store. Records are appended into page aligned slots that rotate through the log region for wear leveling. Every slot carries a sequence number, so the head of the log is found with a binary search instead of a linear scan after power up.
+ * 
+ * @author g.raf
+ * @date 2026-01-25
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ * 
+ * @note This file is part of a larger project and subject to the license specified in the repository. For updates and the complete revision history, see the GitHub repository.
+ * 
+ * @see https://github.com/0x007e/drivers-prom-at24cm0x "AT24CM0X eeprom driver library"
+ */
+
+#include "at24cm0x_log.h"
+
+static unsigned long at24cm0x_log_slot(AT24CM0X_Log *log, unsigned long slot)
+{
+	return log->address + (slot * AT24CM0X_LOG_SLOT_SIZE);
+}
+
+static AT24CM0X_Status at24cm0x_log_header(AT24CM0X_Log *log, unsigned long slot, unsigned char *header, unsigned long *sequence, unsigned int *length)
+{
+	AT24CM0X_Status status = at24cm0x_device_read_sequential(log->device, at24cm0x_log_slot(log, slot), header, AT24CM0X_LOG_HEADER_SIZE);
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		return status;
+	}
+	*sequence = ((unsigned long)header[0]) | ((unsigned long)header[1]<<8) | ((unsigned long)header[2]<<16) | ((unsigned long)header[3]<<24);
+	*length = ((unsigned int)header[4]) | ((unsigned int)header[5]<<8);
+	
+	if(*sequence == 0xFFFFFFFFUL || *length == 0 || *length > AT24CM0X_LOG_RECORD_SIZE)
+	{
+		return AT24CM0X_Status_Data_Error;
+	}
+	return AT24CM0X_Status_Done;
+}
+
+static AT24CM0X_Status at24cm0x_log_load(AT24CM0X_Log *log, unsigned long slot, unsigned long *sequence, unsigned char *data, unsigned int size, unsigned int *length)
+{
+	unsigned char header[AT24CM0X_LOG_HEADER_SIZE];
+	
+	AT24CM0X_Status status = at24cm0x_log_header(log, slot, header, sequence, length);
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		return status;
+	}
+	
+	if(*length > size)
+	{
+		return AT24CM0X_Status_Size_Error;
+	}
+	status = at24cm0x_device_read_sequential(log->device, at24cm0x_log_slot(log, slot) + AT24CM0X_LOG_HEADER_SIZE, data, *length);
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		return status;
+	}
+	
+	unsigned int crc = at24cm0x_crc16(at24cm0x_crc16(0xFFFF, header, AT24CM0X_LOG_CRC_OFFSET), data, *length);
+	
+	if(crc != (((unsigned int)header[AT24CM0X_LOG_CRC_OFFSET]) | ((unsigned int)header[AT24CM0X_LOG_CRC_OFFSET + 1]<<8)))
+	{
+		return AT24CM0X_Status_Data_Error;
+	}
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Opens a circular record log and locates its head.
+ * 
+ * @details
+ * This function assigns the page range [@p page, @p page + @p pages - 1] of the given device to the log and restores the position of the last record. The region is divided into slots of @ref AT24CM0X_LOG_SLOT_SIZE bytes. Records are written to the slots in ascending order and wrap around at the end of the region, so every slot is programmed equally often.
+ * 
+ * Because the sequence number of a record increases by one with every slot, all records of the current pass through the region satisfy `sequence(slot) == sequence(0) + slot`. The head is the last slot for which this holds and is found with a binary search over the slot headers. Only about log2(slots) headers are read, instead of scanning the whole region. A record that was torn by a power loss fails its CRC16 check and is dropped, so the log continues with the previous record.
+ * 
+ * @note A region that contains data of a different use must be cleared once with @ref at24cm0x_log_format, otherwise old data can be mistaken for records.
+ * 
+ * @param log    Pointer to the log structure that will be initialized.
+ * @param device Pointer to the device handle the log is stored on.
+ * @param page   First page of the log region.
+ * @param pages  Number of pages of the log region; must be greater than 0.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Page_Error if the region exceeds the device, @ref AT24CM0X_Status_TWI_Error on a bus error, otherwise @ref AT24CM0X_Status_Done (also for an empty log).
+ */
+AT24CM0X_Status at24cm0x_log_open(AT24CM0X_Log *log, AT24CM0X_Device *device, unsigned int page, unsigned int pages)
+{
+	if(pages == 0 || ((unsigned long)page + pages) > (device->size >> AT24CM0X_PAGE_SHIFT))
+	{
+		return AT24CM0X_Status_Page_Error;
+	}
+	log->device = device;
+	log->address = (unsigned long)page << AT24CM0X_PAGE_SHIFT;
+	log->slots = (unsigned long)pages * (AT24CM0X_PAGE_SIZE / AT24CM0X_LOG_SLOT_SIZE);
+	log->head = 0;
+	log->sequence = 0;
+	log->count = 0;
+	
+	unsigned char buffer[AT24CM0X_LOG_RECORD_SIZE];
+	unsigned long first = 0;
+	unsigned long last = 0;
+	unsigned int length = 0;
+	
+	AT24CM0X_Status status = at24cm0x_log_load(log, 0, &first, buffer, sizeof(buffer), &length);
+	
+	if(status == AT24CM0X_Status_TWI_Error)
+	{
+		return status;
+	}
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		status = at24cm0x_log_load(log, (log->slots - 1), &last, buffer, sizeof(buffer), &length);
+		
+		if(status == AT24CM0X_Status_Done)
+		{
+			log->sequence = last + 1;
+			log->count = log->slots - 1;
+		}
+		return (status == AT24CM0X_Status_TWI_Error ? status : AT24CM0X_Status_Done);
+	}
+	
+	unsigned long low = 0;
+	unsigned long high = log->slots - 1;
+	
+	while(low < high)
+	{
+		unsigned long middle = low + ((high - low + 1) / 2);
+		
+		status = at24cm0x_log_header(log, middle, buffer, &last, &length);
+		
+		if(status == AT24CM0X_Status_TWI_Error)
+		{
+			return status;
+		}
+		
+		if(status == AT24CM0X_Status_Done && last == (first + middle))
+		{
+			low = middle;
+		}
+		else
+		{
+			high = middle - 1;
+		}
+	}
+	
+	unsigned long torn = 0;
+	
+	status = at24cm0x_log_load(log, low, &last, buffer, sizeof(buffer), &length);
+	
+	if(status == AT24CM0X_Status_TWI_Error)
+	{
+		return status;
+	}
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		low--;
+		torn = 1;
+	}
+	last = first + low;
+	
+	log->head = (low + 1) % log->slots;
+	log->sequence = last + 1;
+	log->count = low + 1;
+	
+	if((low + 1 + torn) < log->slots)
+	{
+		unsigned long sequence = 0;
+		
+		status = at24cm0x_log_header(log, (low + 1 + torn), buffer, &sequence, &length);
+		
+		if(status == AT24CM0X_Status_TWI_Error)
+		{
+			return status;
+		}
+		
+		if(status == AT24CM0X_Status_Done && sequence == (last + 1 + torn - log->slots))
+		{
+			log->count = log->slots - torn;
+		}
+	}
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Clears all records of the log.
+ * 
+ * @details
+ * This function erases the header of every slot of the log region (all bytes `0xFF`) and resets the log to an empty state. It has to be called once for a region that contains data of a different use.
+ * 
+ * @note Every slot header is written separately, so the function takes one write cycle per slot. With @ref AT24CM0X_ENABLE_CONDITIONAL_WRITE already erased headers are skipped.
+ * 
+ * @param log Pointer to a log opened with @ref at24cm0x_log_open.
+ * 
+ * @return AT24CM0X_Status Status of the first failing write, or @ref AT24CM0X_Status_Done.
+ */
+AT24CM0X_Status at24cm0x_log_format(AT24CM0X_Log *log)
+{
+	unsigned char header[AT24CM0X_LOG_HEADER_SIZE];
+	
+	for (unsigned char i=0; i < AT24CM0X_LOG_HEADER_SIZE; i++)
+	{
+		header[i] = 0xFF;
+	}
+	
+	for (unsigned long i=0; i < log->slots; i++)
+	{
+		AT24CM0X_Status status = at24cm0x_device_write(log->device, at24cm0x_log_slot(log, i), header, AT24CM0X_LOG_HEADER_SIZE);
+		
+		if(status != AT24CM0X_Status_Done)
+		{
+			return status;
+		}
+	}
+	log->head = 0;
+	log->sequence = 0;
+	log->count = 0;
+	
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Appends a record to the log.
+ * 
+ * @details
+ * This function stores @p size bytes together with the next sequence number and a CRC16 over header and data in the slot at the head of the log. Header and data are written with a single page write. When the end of the region is reached, the log wraps around and overwrites the oldest record.
+ * 
+ * @param log  Pointer to a log opened with @ref at24cm0x_log_open.
+ * @param data Pointer to the record data.
+ * @param size Number of bytes of the record; must be greater than 0 and not larger than @ref AT24CM0X_LOG_RECORD_SIZE.
+ * 
+ * @return AT24CM0X_Status Status code indicating the result of the operation.
+ */
+AT24CM0X_Status at24cm0x_log_append(AT24CM0X_Log *log, const unsigned char *data, unsigned int size)
+{
+	if(size == 0 || size > AT24CM0X_LOG_RECORD_SIZE)
+	{
+		return AT24CM0X_Status_Size_Error;
+	}
+	
+	unsigned char slot[AT24CM0X_LOG_SLOT_SIZE];
+	
+	slot[0] = (unsigned char)(log->sequence);
+	slot[1] = (unsigned char)(log->sequence>>8);
+	slot[2] = (unsigned char)(log->sequence>>16);
+	slot[3] = (unsigned char)(log->sequence>>24);
+	slot[4] = (unsigned char)(size);
+	slot[5] = (unsigned char)(size>>8);
+	
+	for (unsigned int i=0; i < size; i++)
+	{
+		slot[AT24CM0X_LOG_HEADER_SIZE + i] = *(data + i);
+	}
+	
+	unsigned int crc = at24cm0x_crc16(at24cm0x_crc16(0xFFFF, slot, AT24CM0X_LOG_CRC_OFFSET), data, size);
+	
+	slot[AT24CM0X_LOG_CRC_OFFSET] = (unsigned char)(crc);
+	slot[AT24CM0X_LOG_CRC_OFFSET + 1] = (unsigned char)(crc>>8);
+	
+	AT24CM0X_Status status = at24cm0x_device_write(log->device, at24cm0x_log_slot(log, log->head), slot, (AT24CM0X_LOG_HEADER_SIZE + size));
+	
+	if(status != AT24CM0X_Status_Done)
+	{
+		return status;
+	}
+	log->head = (log->head + 1) % log->slots;
+	log->sequence++;
+	
+	if(log->count < log->slots)
+	{
+		log->count++;
+	}
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Reads a record from the log.
+ * 
+ * @details
+ * This function reads the record with the given age, where age `0` is the most recently appended record and `log->count - 1` the oldest one. The CRC16 of the record is checked before the data is returned.
+ * 
+ * @param log    Pointer to a log opened with @ref at24cm0x_log_open.
+ * @param age    Age of the record, in the range [0, `log->count` - 1].
+ * @param data   Pointer to the buffer where the record data will be stored.
+ * @param size   Size of the buffer in bytes.
+ * @param length Pointer where the length of the record will be stored.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Address_Error if no record with this age exists, @ref AT24CM0X_Status_Size_Error if the buffer is too small, @ref AT24CM0X_Status_Data_Error if the record is corrupted, otherwise the status of the read.
+ */
+AT24CM0X_Status at24cm0x_log_read(AT24CM0X_Log *log, unsigned long age, unsigned char *data, unsigned int size, unsigned int *length)
+{
+	if(age >= log->count)
+	{
+		return AT24CM0X_Status_Address_Error;
+	}
+	unsigned long sequence = 0;
+	
+	return at24cm0x_log_load(log, ((log->head + log->slots - 1 - age) % log->slots), &sequence, data, size, length);
+}
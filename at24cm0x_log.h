@@ -0,0 +1,85 @@
+/**
+ * @file at24cm0x_log.h
+ * @brief Header file with declarations and macros for a circular record log on an at24cm0x.
+ * 
+ * This file provides function prototypes, type definitions, and constants for a log-structured record store that is built on top of the at24cm0x driver.
+ * 
+ * @author g.raf
+ * @date 2026-01-24
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ * 
+ * @note This file is part of a larger project and subject to the license specified in the repository. For updates and the complete revision history, see the GitHub repository.
+ * 
+ * @see https://github.com/0x007e/drivers-prom-at24cm0x "AT24CM0X eeprom driver library"
+ */
+
+#ifndef AT24CM0X_LOG_H_
+#define AT24CM0X_LOG_H_
+
+	#ifndef AT24CM0X_LOG_SLOT_SIZE
+		/**
+		 * @def AT24CM0X_LOG_SLOT_SIZE
+		 * @brief Size of a single record slot of the log in bytes.
+		 * 
+		 *  Every record is stored in its own slot. Slots are aligned to the start of the log region and never cross a page boundary, so a record is always written with a single page write. Each slot starts with a header of @ref AT24CM0X_LOG_HEADER_SIZE bytes (sequence number, length and CRC16), the remaining bytes are available for the record data.
+		 * 
+		 * @note The default value `32UL` allows records of up to 24 bytes. The value has to be a divider of @ref AT24CM0X_PAGE_SIZE. A temporary buffer of this size is placed on the stack during @ref at24cm0x_log_append.
+		 */
+		#define AT24CM0X_LOG_SLOT_SIZE 32UL
+	#endif
+	
+	/**
+	 * @def AT24CM0X_LOG_HEADER_SIZE
+	 * @brief Size of the header at the start of every slot in bytes.
+	 */
+	#define AT24CM0X_LOG_HEADER_SIZE 8UL
+	
+	/**
+	 * @def AT24CM0X_LOG_CRC_OFFSET
+	 * @brief Offset of the CRC16 within the header, which is also the number of header bytes covered by the CRC.
+	 */
+	#define AT24CM0X_LOG_CRC_OFFSET (AT24CM0X_LOG_HEADER_SIZE - 2UL)
+	
+	/**
+	 * @def AT24CM0X_LOG_RECORD_SIZE
+	 * @brief Maximum number of data bytes of a single record.
+	 */
+	#define AT24CM0X_LOG_RECORD_SIZE (AT24CM0X_LOG_SLOT_SIZE - AT24CM0X_LOG_HEADER_SIZE)
+	
+	#include "at24cm0x.h"
+	
+	#if (AT24CM0X_PAGE_SIZE % AT24CM0X_LOG_SLOT_SIZE) != 0 || AT24CM0X_LOG_SLOT_SIZE <= AT24CM0X_LOG_HEADER_SIZE
+		#error "AT24CM0X_LOG_SLOT_SIZE must be a divider of AT24CM0X_PAGE_SIZE and larger than AT24CM0X_LOG_HEADER_SIZE!"
+	#endif
+	
+	/**
+	 * @struct AT24CM0X_Log_t
+	 * @brief State of a circular record log.
+	 * 
+	 * @details
+	 * The structure is filled by @ref at24cm0x_log_open and updated by @ref at24cm0x_log_append. All members are managed by the log module and should only be read by the application.
+	 */
+	struct AT24CM0X_Log_t
+	{
+		AT24CM0X_Device *device;   /**< Device handle the log is stored on. */
+		unsigned long address;     /**< Start address of the log region. */
+		unsigned long slots;       /**< Number of slots in the log region. */
+		unsigned long head;        /**< Slot that will receive the next record. */
+		unsigned long sequence;    /**< Sequence number of the next record. */
+		unsigned long count;       /**< Number of records that can be read with @ref at24cm0x_log_read. */
+	};
+	/**
+	 * @typedef AT24CM0X_Log
+	 * @brief Alias for struct AT24CM0X_Log_t.
+	 */
+	typedef struct AT24CM0X_Log_t AT24CM0X_Log;
+	
+	AT24CM0X_Status at24cm0x_log_open(AT24CM0X_Log *log, AT24CM0X_Device *device, unsigned int page, unsigned int pages);
+	AT24CM0X_Status at24cm0x_log_format(AT24CM0X_Log *log);
+	AT24CM0X_Status at24cm0x_log_append(AT24CM0X_Log *log, const unsigned char *data, unsigned int size);
+	AT24CM0X_Status at24cm0x_log_read(AT24CM0X_Log *log, unsigned long age, unsigned char *data, unsigned int size, unsigned int *length);
+
+#endif /* AT24CM0X_LOG_H_ */
@@ -0,0 +1,228 @@
+/**
+ * @file at24cm0x_volume.c
+ * 
+ * @brief Implementation of a linear volume across several AT24CM0X devices.
+ * 
+ * This file contains the implementation of a volume layer that maps one linear address space onto several devices on the bus, either concatenated or striped page by page. In striped mode, large writes are passed to @ref at24cm0x_write_parallel, so the write cycles of all devices overlap.
+ * 
+ * @author g.raf
+ * @date 2026-01-25
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ * 
+ * @note This file is part of a larger project and subject to the license specified in the repository. For updates and the complete revision history, see the GitHub repository.
+ * 
+ * @see https://github.com/0x007e/drivers-prom-at24cm0x "AT24CM0X eeprom driver library"
+ */
+
+#include "at24cm0x_volume.h"
+
+static unsigned long at24cm0x_volume_map(AT24CM0X_Volume *volume, unsigned long address, unsigned char *index, unsigned long *offset)
+{
+	if(volume->mode == AT24CM0X_Volume_Mode_Striped)
+	{
+		unsigned long page = address >> AT24CM0X_PAGE_SHIFT;
+		
+		*index = (unsigned char)(page % volume->count);
+		*offset = ((page / volume->count) << AT24CM0X_PAGE_SHIFT) | (address & AT24CM0X_PAGE_MASK);
+		
+		return AT24CM0X_PAGE_SIZE - (address & AT24CM0X_PAGE_MASK);
+	}
+	
+	unsigned char i = 0;
+	
+	while(address >= volume->devices[i]->size)
+	{
+		address -= volume->devices[i]->size;
+		i++;
+	}
+	*index = i;
+	*offset = address;
+	
+	return volume->devices[i]->size - address;
+}
+
+static AT24CM0X_Status at24cm0x_volume_check(AT24CM0X_Volume *volume, unsigned long address, unsigned long size)
+{
+	if(address >= volume->size)
+	{
+		return AT24CM0X_Status_Address_Error;
+	}
+	
+	if(size == 0 || size > (volume->size - address))
+	{
+		return AT24CM0X_Status_Size_Error;
+	}
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Initializes a volume across several AT24CM0X devices.
+ * 
+ * @details
+ * This function combines the internal handles (see @ref at24cm0x_device_handle) of the given devices to one linear address space. With @ref AT24CM0X_Volume_Mode_Concatenated the devices follow each other in the given order and the volume size is the sum of the device sizes. With @ref AT24CM0X_Volume_Mode_Striped volume page `p` is located on device `p % count` at device page `p / count`, and the volume size is `count` times the smallest device size.
+ * 
+ * @note @ref at24cm0x_init has to be called before, and the device sizes must not be changed while the volume is in use.
+ * 
+ * @param volume      Pointer to the volume structure that will be initialized.
+ * @param identifiers Pointer to the device selector values of the devices, as used by @ref at24cm0x_device.
+ * @param count       Number of devices, in the range [1, @ref AT24CM0X_VOLUME_DEVICES].
+ * @param mode        Layout of the devices within the volume.
+ * 
+ * @return AT24CM0X_Status @ref AT24CM0X_Status_Size_Error if @p count is invalid, @ref AT24CM0X_Status_Address_Error if a device is given twice, otherwise @ref AT24CM0X_Status_Done.
+ */
+AT24CM0X_Status at24cm0x_volume_init(AT24CM0X_Volume *volume, const unsigned char *identifiers, unsigned char count, AT24CM0X_Volume_Mode mode)
+{
+	if(count == 0 || count > AT24CM0X_VOLUME_DEVICES)
+	{
+		return AT24CM0X_Status_Size_Error;
+	}
+	
+	unsigned long minimum = AT24CM0X_MEMORY_SIZE;
+	
+	volume->count = count;
+	volume->mode = mode;
+	volume->size = 0;
+	
+	for (unsigned char i=0; i < count; i++)
+	{
+		volume->devices[i] = at24cm0x_device_handle(*(identifiers + i));
+		
+		for (unsigned char j=0; j < i; j++)
+		{
+			if(volume->devices[j] == volume->devices[i])
+			{
+				volume->count = 0;
+				return AT24CM0X_Status_Address_Error;
+			}
+		}
+		volume->size += volume->devices[i]->size;
+		
+		if(volume->devices[i]->size < minimum)
+		{
+			minimum = volume->devices[i]->size;
+		}
+	}
+	
+	if(mode == AT24CM0X_Volume_Mode_Striped)
+	{
+		volume->size = (minimum & ~AT24CM0X_PAGE_MASK) * count;
+	}
+	return AT24CM0X_Status_Done;
+}
+
+/**
+ * @brief Writes a block of bytes to a volume.
+ * 
+ * @details
+ * This function splits the block at device and page boundaries and writes every part with the handle based functions of the driver, so write-protect handling, write cycle timing, integrity checking and caching are the same as for @ref at24cm0x_device_write.
+ * 
+ * In striped mode with @ref AT24CM0X_WRITE_ACKNOWLEDGE_POLLING, up to `count` consecutive pages, which are located on different devices, are passed to @ref at24cm0x_write_parallel at once. The page of one device is transferred while the other devices are still programming, so the sustained write throughput scales with the number of devices.
+ * 
+ * @param volume  Pointer to a volume initialized with @ref at24cm0x_volume_init.
+ * @param address Start address within the volume.
+ * @param data    Pointer to the buffer containing the data to be written.
+ * @param size    Number of bytes to write; must be greater than 0.
+ * 
+ * @return AT24CM0X_Status Status of the first failing write, or @ref AT24CM0X_Status_Done.
+ */
+AT24CM0X_Status at24cm0x_volume_write(AT24CM0X_Volume *volume, unsigned long address, const unsigned char *data, unsigned long size)
+{
+	AT24CM0X_Status status = at24cm0x_volume_check(volume, address, size);
+	
+	#ifdef AT24CM0X_WRITE_ACKNOWLEDGE_POLLING
+		if(volume->mode == AT24CM0X_Volume_Mode_Striped)
+		{
+			AT24CM0X_Write_Job jobs[AT24CM0X_VOLUME_DEVICES];
+			
+			while(status == AT24CM0X_Status_Done && size > 0)
+			{
+				unsigned char count = 0;
+				
+				while(count < volume->count && size > 0)
+				{
+					unsigned char index = 0;
+					unsigned long offset = 0;
+					unsigned long chunk = at24cm0x_volume_map(volume, address, &index, &offset);
+					
+					if(chunk > size)
+					{
+						chunk = size;
+					}
+					jobs[count].identifier = volume->devices[index]->identifier;
+					jobs[count].address = offset;
+					jobs[count].data = data;
+					jobs[count].size = chunk;
+					count++;
+					
+					address += chunk;
+					data += chunk;
+					size -= chunk;
+				}
+				status = at24cm0x_write_parallel(jobs, count);
+			}
+			return status;
+		}
+	#endif
+	
+	while(status == AT24CM0X_Status_Done && size > 0)
+	{
+		unsigned char index = 0;
+		unsigned long offset = 0;
+		unsigned long chunk = at24cm0x_volume_map(volume, address, &index, &offset);
+		
+		if(chunk > size)
+		{
+			chunk = size;
+		}
+		status = at24cm0x_device_write(volume->devices[index], offset, data, chunk);
+		
+		address += chunk;
+		data += chunk;
+		size -= chunk;
+	}
+	return status;
+}
+
+/**
+ * @brief Reads a block of bytes from a volume.
+ * 
+ * @details
+ * This function splits the block at device boundaries (concatenated mode) or page boundaries (striped mode) and reads every part with @ref at24cm0x_device_read_sequential.
+ * 
+ * @param volume  Pointer to a volume initialized with @ref at24cm0x_volume_init.
+ * @param address Start address within the volume.
+ * @param data    Pointer to the buffer where the received data will be stored.
+ * @param size    Number of bytes to read; must be greater than 0.
+ * 
+ * @return AT24CM0X_Status Status of the first failing read, or @ref AT24CM0X_Status_Done.
+ */
+AT24CM0X_Status at24cm0x_volume_read(AT24CM0X_Volume *volume, unsigned long address, unsigned char *data, unsigned long size)
+{
+	AT24CM0X_Status status = at24cm0x_volume_check(volume, address, size);
+	
+	while(status == AT24CM0X_Status_Done && size > 0)
+	{
+		unsigned char index = 0;
+		unsigned long offset = 0;
+		unsigned long chunk = at24cm0x_volume_map(volume, address, &index, &offset);
+		
+		if(chunk > size)
+		{
+			chunk = size;
+		}
+		
+		if(chunk > 0x8000UL)
+		{
+			chunk = 0x8000UL;
+		}
+		status = at24cm0x_device_read_sequential(volume->devices[index], offset, data, (unsigned int)chunk);
+		
+		address += chunk;
+		data += chunk;
+		size -= chunk;
+	}
+	return status;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file at24cm0x_volume.h
+ * @brief Header file with declarations and macros for a linear volume across several at24cm0x devices.
+ * 
+ * This file provides function prototypes, type definitions, and constants for a volume layer that presents several AT24CM0X devices on the bus as one linear address space and is built on top of the at24cm0x driver.
+ * 
+ * @author g.raf
+ * @date 2026-01-24
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ * 
+ * @note This file is part of a larger project and subject to the license specified in the repository. For updates and the complete revision history, see the GitHub repository.
+ * 
+ * @see https://github.com/0x007e/drivers-prom-at24cm0x "AT24CM0X eeprom driver library"
+ */
+
+#ifndef AT24CM0X_VOLUME_H_
+#define AT24CM0X_VOLUME_H_
+
+	#include "at24cm0x.h"
+	
+	#ifndef AT24CM0X_MULTI_DEVICES
+		#error "The volume layer requires AT24CM0X_MULTI_DEVICES!"
+	#endif
+	
+	/**
+	 * @def AT24CM0X_VOLUME_DEVICES
+	 * @brief Maximum number of devices of a volume.
+	 * 
+	 *  This is the number of devices that can be selected on the bus (see @ref AT24CM0X_DEVICES).
+	 */
+	#define AT24CM0X_VOLUME_DEVICES AT24CM0X_DEVICES
+	
+	/**
+	 * @enum AT24CM0X_Volume_Mode_t
+	 * @brief Layout of the devices within a volume.
+	 */
+	enum AT24CM0X_Volume_Mode_t
+	{
+		AT24CM0X_Volume_Mode_Concatenated = 0,   /**< The devices follow each other in the order given to @ref at24cm0x_volume_init. */
+		AT24CM0X_Volume_Mode_Striped             /**< Consecutive pages rotate across the devices. */
+	};
+	/**
+	 * @typedef AT24CM0X_Volume_Mode
+	 * @brief Alias for enum AT24CM0X_Volume_Mode_t.
+	 */
+	typedef enum AT24CM0X_Volume_Mode_t AT24CM0X_Volume_Mode;
+	
+	/**
+	 * @struct AT24CM0X_Volume_t
+	 * @brief State of a volume.
+	 * 
+	 * @details
+	 * The structure is filled by @ref at24cm0x_volume_init. All members are managed by the volume layer and should only be read by the application.
+	 */
+	struct AT24CM0X_Volume_t
+	{
+		AT24CM0X_Device *devices[AT24CM0X_VOLUME_DEVICES];  /**< Internal handles of the devices (see @ref at24cm0x_device_handle). */
+		unsigned char count;                                 /**< Number of devices of the volume. */
+		AT24CM0X_Volume_Mode mode;                           /**< Layout of the devices. */
+		unsigned long size;                                  /**< Size of the volume in bytes. */
+	};
+	/**
+	 * @typedef AT24CM0X_Volume
+	 * @brief Alias for struct AT24CM0X_Volume_t.
+	 */
+	typedef struct AT24CM0X_Volume_t AT24CM0X_Volume;
+	
+	AT24CM0X_Status at24cm0x_volume_init(AT24CM0X_Volume *volume, const unsigned char *identifiers, unsigned char count, AT24CM0X_Volume_Mode mode);
+	AT24CM0X_Status at24cm0x_volume_write(AT24CM0X_Volume *volume, unsigned long address, const unsigned char *data, unsigned long size);
+	AT24CM0X_Status at24cm0x_volume_read(AT24CM0X_Volume *volume, unsigned long address, unsigned char *data, unsigned long size);
+
+#endif /* AT24CM0X_VOLUME_H_ */
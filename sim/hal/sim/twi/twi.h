@@ -0,0 +1,38 @@
+/**
+ * @file twi.h
+ * @brief Simulated TWI HAL for host builds of the AT24CM0X driver.
+ * 
+ * This file provides the TWI functions the driver expects from a platform HAL. The bus and the EEPROM devices are modelled in sim/twi_sim.c.
+ * 
+ * @note As with the hardware HAL, a missing address acknowledge (device busy in its write cycle or absent) is returned as `TWI_Ack` by @ref twi_address.
+ */
+
+#ifndef TWI_H_
+#define TWI_H_
+
+	enum TWI_Operation_t
+	{
+		TWI_Write = 0,
+		TWI_Read,
+		TWI_Ack,
+		TWI_NACK
+	};
+	typedef enum TWI_Operation_t TWI_Operation;
+	
+	enum TWI_Error_t
+	{
+		TWI_None = 0,
+		TWI_Error_Start = 0x01,
+		TWI_Error_Data = 0x04,
+		TWI_Error_Arbitration = 0x08
+	};
+	typedef enum TWI_Error_t TWI_Error;
+	
+	     void twi_init(void);
+	     void twi_start(void);
+	     void twi_stop(void);
+	TWI_Error twi_address(unsigned char address, TWI_Operation operation);
+	TWI_Error twi_set(unsigned char data);
+	TWI_Error twi_get(unsigned char *data, TWI_Operation acknowledge);
+
+#endif /* TWI_H_ */
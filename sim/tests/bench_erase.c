@@ -0,0 +1,45 @@
+/* Write cycles of at24cm0x_erase_all on a written and on an erased device. */
+#include <stdio.h>
+#include <string.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+int main(void)
+{
+	memset(sim_memory[0], 0x12, SIM_MEMORY_SIZE);
+	at24cm0x_init();
+	
+	if(at24cm0x_fill(100, 0x00, 600) != AT24CM0X_Status_Done || sim_memory[0][99] != 0x12 || sim_memory[0][100] != 0x00 || sim_memory[0][699] != 0x00 || sim_memory[0][700] != 0x12)
+	{
+		return 1;
+	}
+	sim_reset();
+	
+	if(at24cm0x_erase_all() != AT24CM0X_Status_Done)
+	{
+		return 2;
+	}
+	printf("erase written device: %lu write cycles\n", sim_write_cycles);
+	
+	for (unsigned long i=0; i < SIM_MEMORY_SIZE; i++)
+	{
+		if(sim_memory[0][i] != 0xFF)
+		{
+			return 3;
+		}
+	}
+	sim_reset();
+	
+	if(at24cm0x_erase_all() != AT24CM0X_Status_Done)
+	{
+		return 4;
+	}
+	printf("erase erased device: %lu write cycles, %lu bus bytes\n", sim_write_cycles, sim_bus_bytes);
+	
+	#ifdef AT24CM0X_ENABLE_CONDITIONAL_WRITE
+		return (sim_write_cycles == 0 ? 0 : 5);
+	#else
+		return (sim_write_cycles == 1024 ? 0 : 5);
+	#endif
+}
@@ -0,0 +1,74 @@
+/* Write cycles of whole-chip image programming and the dump transaction. */
+#include <stdio.h>
+#include <string.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+static unsigned long mismatches;
+
+static AT24CM0X_Status image_page(unsigned long address, unsigned char *data, unsigned int size)
+{
+	for (unsigned int i=0; i < size; i++)
+	{
+		*(data + i) = (address >= 0x20000UL ? 0xFF : (unsigned char)((address + i) * 13));
+	}
+	return AT24CM0X_Status_Done;
+}
+
+static AT24CM0X_Status check_page(unsigned long address, unsigned char *data, unsigned int size)
+{
+	unsigned char expected[AT24CM0X_PAGE_SIZE];
+	
+	image_page(address, expected, size);
+	
+	if(memcmp(data, expected, size))
+	{
+		mismatches++;
+	}
+	return AT24CM0X_Status_Done;
+}
+
+int main(void)
+{
+	memset(sim_memory, 0xFF, sizeof(sim_memory));
+	at24cm0x_init();
+	sim_reset();
+	
+	if(at24cm0x_program_image(image_page, AT24CM0X_Image_Mode_All) != AT24CM0X_Status_Done)
+	{
+		return 1;
+	}
+	printf("all: %lu write cycles in %lu ms\n", sim_write_cycles, sim_ms());
+	
+	if(sim_write_cycles != 1024)
+	{
+		return 2;
+	}
+	unsigned long cycles = sim_write_cycles;
+	
+	if(at24cm0x_program_image(image_page, AT24CM0X_Image_Mode_Skip_Equal) != AT24CM0X_Status_Done || sim_write_cycles != cycles)
+	{
+		return 3;
+	}
+	printf("skip equal: %lu write cycles\n", sim_write_cycles - cycles);
+	
+	memset(sim_memory[0], 0xFF, SIM_MEMORY_SIZE);
+	cycles = sim_write_cycles;
+	
+	if(at24cm0x_program_image(image_page, AT24CM0X_Image_Mode_Skip_Blank) != AT24CM0X_Status_Done || (sim_write_cycles - cycles) != 512)
+	{
+		return 4;
+	}
+	printf("skip blank: %lu write cycles\n", sim_write_cycles - cycles);
+	
+	unsigned long starts = sim_starts;
+	
+	if(at24cm0x_dump(check_page) != AT24CM0X_Status_Done || mismatches)
+	{
+		return 5;
+	}
+	printf("dump: %lu start conditions\n", sim_starts - starts);
+	
+	return 0;
+}
@@ -0,0 +1,61 @@
+/* Bus traffic of at24cm0x_log_open on a wrapped 32 slot log. */
+#include <stdio.h>
+#include <string.h>
+
+#include "at24cm0x_log.h"
+#include "../twi_sim.h"
+
+int main(void)
+{
+	AT24CM0X_Device device;
+	AT24CM0X_Log log;
+	AT24CM0X_Log opened;
+	unsigned char record[32];
+	unsigned int length;
+	
+	memset(sim_memory, 0xFF, sizeof(sim_memory));
+	at24cm0x_init();
+	at24cm0x_device_init(&device, 0x04);
+	
+	if(at24cm0x_log_open(&log, &device, 10, 4) != AT24CM0X_Status_Done || log.count != 0)
+	{
+		return 1;
+	}
+	
+	for (unsigned long i=0; i < 45; i++)
+	{
+		unsigned char data[10];
+		
+		memset(data, (unsigned char)i, sizeof(data));
+		
+		if(at24cm0x_log_append(&log, data, (unsigned int)(1 + (i % 10))) != AT24CM0X_Status_Done)
+		{
+			return 2;
+		}
+	}
+	
+	unsigned long bytes = sim_bus_bytes;
+	
+	if(at24cm0x_log_open(&opened, &device, 10, 4) != AT24CM0X_Status_Done)
+	{
+		return 3;
+	}
+	printf("open of %lu slots: %lu bus bytes (region %lu bytes)\n", opened.slots, (sim_bus_bytes - bytes), (opened.slots * AT24CM0X_LOG_SLOT_SIZE));
+	
+	if(opened.head != log.head || opened.sequence != 45 || opened.count != 32)
+	{
+		return 4;
+	}
+	
+	if(at24cm0x_log_read(&opened, 0, record, sizeof(record), &length) != AT24CM0X_Status_Done || record[0] != 44)
+	{
+		return 5;
+	}
+	
+	if(at24cm0x_log_read(&opened, 31, record, sizeof(record), &length) != AT24CM0X_Status_Done || record[0] != 13)
+	{
+		return 6;
+	}
+	
+	return 0;
+}
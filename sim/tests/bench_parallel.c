@@ -0,0 +1,45 @@
+/* Two 4 KiB jobs with at24cm0x_write_parallel against two sequential writes. */
+#include <stdio.h>
+#include <string.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+static unsigned char data[4096];
+
+int main(void)
+{
+	for (unsigned int i=0; i < sizeof(data); i++)
+	{
+		data[i] = (unsigned char)(i * 7 + 1);
+	}
+	at24cm0x_init();
+	sim_reset();
+	
+	AT24CM0X_Write_Job jobs[] = {
+		{ .identifier = 0x04, .address = 0, .data = data, .size = sizeof(data) },
+		{ .identifier = 0x00, .address = 0, .data = data, .size = sizeof(data) }
+	};
+	
+	if(at24cm0x_write_parallel(jobs, 2) != AT24CM0X_Status_Done)
+	{
+		return 1;
+	}
+	unsigned long parallel = sim_time_us;
+	
+	sim_reset();
+	
+	if(at24cm0x_device_write(at24cm0x_device_handle(0x04), 0, data, sizeof(data)) != AT24CM0X_Status_Done || at24cm0x_device_write(at24cm0x_device_handle(0x00), 0, data, sizeof(data)) != AT24CM0X_Status_Done)
+	{
+		return 2;
+	}
+	unsigned long sequential = sim_time_us;
+	
+	if(memcmp(sim_memory[0], data, sizeof(data)) || memcmp(sim_memory[1], data, sizeof(data)))
+	{
+		return 3;
+	}
+	printf("parallel %lu us, sequential %lu us (%lu%%)\n", parallel, sequential, (parallel * 100UL) / sequential);
+	
+	return (parallel < sequential ? 0 : 4);
+}
@@ -0,0 +1,51 @@
+/* Bus bytes of 16 byte linear reads, built with and without the read-ahead window. */
+#include <stdio.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+int main(void)
+{
+	unsigned char data[16];
+	
+	for (unsigned long i=0; i < SIM_MEMORY_SIZE; i++)
+	{
+		sim_memory[0][i] = (unsigned char)(i * 7);
+	}
+	at24cm0x_init();
+	sim_reset();
+	
+	for (unsigned long address=1000; address < (1000 + 1024); address += sizeof(data))
+	{
+		if(at24cm0x_read_sequential(address, data, sizeof(data)) != AT24CM0X_Status_Done)
+		{
+			return 1;
+		}
+		
+		for (unsigned int i=0; i < sizeof(data); i++)
+		{
+			if(data[i] != (unsigned char)((address + i) * 7))
+			{
+				return 2;
+			}
+		}
+	}
+	printf("1 KiB in 16 byte reads: %lu bus bytes, %lu us\n", sim_bus_bytes, sim_time_us);
+	
+	const unsigned char update[4] = { 9, 9, 9, 9 };
+	
+	at24cm0x_read_sequential(5000, data, 8);
+	at24cm0x_read_sequential(5008, data, 8);
+	at24cm0x_write(5020, update, sizeof(update));
+	
+	if(at24cm0x_read_sequential(5016, data, 8) != AT24CM0X_Status_Done || data[4] != 9 || data[3] != (unsigned char)(5019 * 7))
+	{
+		return 3;
+	}
+	
+	if(at24cm0x_read_sequential(SIM_MEMORY_SIZE - 8, data, 8) != AT24CM0X_Status_Done || at24cm0x_read_sequential(SIM_MEMORY_SIZE - 4, data, 4) != AT24CM0X_Status_Done || data[3] != (unsigned char)((SIM_MEMORY_SIZE - 1) * 7))
+	{
+		return 4;
+	}
+	return 0;
+}
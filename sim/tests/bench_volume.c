@@ -0,0 +1,63 @@
+/* 8 KiB striped volume write over two devices against a single device. */
+#include <stdio.h>
+#include <string.h>
+
+#include "at24cm0x_volume.h"
+#include "../twi_sim.h"
+
+static unsigned char data[8192];
+static unsigned char result[8192];
+
+int main(void)
+{
+	AT24CM0X_Volume volume;
+	const unsigned char devices[] = { 0x00, 0x04, 0x02 };
+	
+	for (unsigned int i=0; i < sizeof(data); i++)
+	{
+		data[i] = (unsigned char)(i * 7 + 3);
+	}
+	memset(sim_memory, 0xFF, sizeof(sim_memory));
+	at24cm0x_init();
+	
+	if(at24cm0x_volume_init(&volume, devices, sizeof(devices), AT24CM0X_Volume_Mode_Concatenated) != AT24CM0X_Status_Size_Error)
+	{
+		return 1;
+	}
+	
+	if(at24cm0x_volume_init(&volume, devices, 2, AT24CM0X_Volume_Mode_Concatenated) != AT24CM0X_Status_Done || volume.size != (2 * SIM_MEMORY_SIZE))
+	{
+		return 2;
+	}
+	
+	if(at24cm0x_volume_write(&volume, SIM_MEMORY_SIZE - 100, data, 300) != AT24CM0X_Status_Done || memcmp(sim_memory[1] + SIM_MEMORY_SIZE - 100, data, 100) || memcmp(sim_memory[0], data + 100, 200))
+	{
+		return 3;
+	}
+	
+	if(at24cm0x_volume_init(&volume, devices, 2, AT24CM0X_Volume_Mode_Striped) != AT24CM0X_Status_Done)
+	{
+		return 4;
+	}
+	sim_reset();
+	
+	if(at24cm0x_volume_write(&volume, 10, data, sizeof(data)) != AT24CM0X_Status_Done)
+	{
+		return 5;
+	}
+	unsigned long striped = sim_time_us;
+	
+	if(at24cm0x_volume_read(&volume, 10, result, sizeof(result)) != AT24CM0X_Status_Done || memcmp(result, data, sizeof(data)))
+	{
+		return 6;
+	}
+	sim_reset();
+	
+	if(at24cm0x_device_write(at24cm0x_device_handle(0x04), 0, data, sizeof(data)) != AT24CM0X_Status_Done)
+	{
+		return 7;
+	}
+	printf("8 KiB striped %lu us, single device %lu us\n", striped, sim_time_us);
+	
+	return (striped < sim_time_us ? 0 : 8);
+}
@@ -0,0 +1,48 @@
+/* Write cycles of 256 sequential single byte writes through the write queue. */
+#include <stdio.h>
+#include <string.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+int main(void)
+{
+	unsigned char data[20];
+	
+	memset(sim_memory, 0xFF, sizeof(sim_memory));
+	at24cm0x_init();
+	sim_reset();
+	
+	for (unsigned int i=0; i < 256; i++)
+	{
+		if(at24cm0x_write_byte(4096 + i, (unsigned char)i) != AT24CM0X_Status_Done)
+		{
+			return 1;
+		}
+	}
+	
+	if(at24cm0x_write_queue_flush() != AT24CM0X_Status_Done)
+	{
+		return 2;
+	}
+	printf("256 single byte writes: %lu write cycles\n", sim_write_cycles);
+	
+	for (unsigned int i=0; i < 256; i++)
+	{
+		if(sim_memory[0][4096 + i] != (unsigned char)i)
+		{
+			return 3;
+		}
+	}
+	
+	at24cm0x_write_byte(100, 0xAA);
+	
+	if(at24cm0x_read_sequential(98, data, sizeof(data)) != AT24CM0X_Status_Done || data[2] != 0xAA || sim_memory[0][100] != 0xFF)
+	{
+		return 4;
+	}
+	sim_time_us += (AT24CM0X_WRITE_QUEUE_DEADLINE_MS + 1) * 1000UL;
+	at24cm0x_write_queue_task();
+	
+	return (sim_memory[0][100] == 0xAA ? 0 : 5);
+}
@@ -0,0 +1,59 @@
+/* A second commit without a new block is rejected and the active block stays intact. */
+#include <stdio.h>
+#include <string.h>
+
+#include "at24cm0x_ab.h"
+#include "../twi_sim.h"
+
+static unsigned char data[1000];
+
+int main(void)
+{
+	AT24CM0X_Device device;
+	AT24CM0X_AB ab;
+	
+	for (unsigned int i=0; i < sizeof(data); i++)
+	{
+		data[i] = (unsigned char)(i * 5 + 1);
+	}
+	memset(sim_memory, 0xFF, sizeof(sim_memory));
+	at24cm0x_init();
+	at24cm0x_device_init(&device, 0x04);
+	
+	if(at24cm0x_ab_open(&ab, &device, 32, 16) != AT24CM0X_Status_Done || at24cm0x_ab_commit(&ab) != AT24CM0X_Status_Data_Error)
+	{
+		return 1;
+	}
+	at24cm0x_ab_begin(&ab);
+	
+	if(at24cm0x_ab_stream(&ab, data, sizeof(data)) != AT24CM0X_Status_Done || at24cm0x_ab_commit(&ab) != AT24CM0X_Status_Done)
+	{
+		return 2;
+	}
+	
+	if(at24cm0x_ab_commit(&ab) != AT24CM0X_Status_Data_Error)
+	{
+		return 3;
+	}
+	
+	if(at24cm0x_ab_open(&ab, &device, 32, 16) != AT24CM0X_Status_Done || ab.active != 0 || ab.size != sizeof(data) || at24cm0x_ab_check(&ab) != AT24CM0X_Status_Done)
+	{
+		return 4;
+	}
+	
+	if(at24cm0x_ab_stream(&ab, data, 100) != AT24CM0X_Status_Done || at24cm0x_ab_commit(&ab) != AT24CM0X_Status_Done)
+	{
+		return 5;
+	}
+	
+	if(at24cm0x_ab_stream(&ab, data + 100, 200) != AT24CM0X_Status_Done || at24cm0x_ab_commit(&ab) != AT24CM0X_Status_Done)
+	{
+		return 6;
+	}
+	
+	if(at24cm0x_ab_open(&ab, &device, 32, 16) != AT24CM0X_Status_Done || ab.active != 0 || ab.size != 200 || at24cm0x_ab_check(&ab) != AT24CM0X_Status_Done)
+	{
+		return 7;
+	}
+	return 0;
+}
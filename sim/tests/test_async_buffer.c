@@ -0,0 +1,60 @@
+/* Buffered asynchronous jobs with a failed address phase end with a bus error and no data phase. */
+#include <stdio.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+static void run(void)
+{
+	for (unsigned int i=0; i < 200 && at24cm0x_async_status() == AT24CM0X_Status_Busy; i++)
+	{
+		sim_time_us += 1000UL;
+		at24cm0x_task();
+	}
+}
+
+int main(void)
+{
+	unsigned char data[16] = { 1, 2, 3 };
+	
+	at24cm0x_init();
+	sim_reset();
+	
+	sim_fail_after(1);
+	
+	if(at24cm0x_write_async(0x40, data, sizeof(data), 0) != AT24CM0X_Status_Done)
+	{
+		return 1;
+	}
+	run();
+	printf("write: status %d after %lu bus bytes\n", at24cm0x_async_status(), sim_bus_bytes);
+	
+	if(at24cm0x_async_status() != AT24CM0X_Status_TWI_Error || sim_buffer_transfers != 0)
+	{
+		return 2;
+	}
+	sim_reset();
+	sim_present[0] = 0;
+	
+	if(at24cm0x_read_async(0x40, data, sizeof(data), 0) != AT24CM0X_Status_Done)
+	{
+		return 3;
+	}
+	run();
+	printf("read: status %d after %lu bus bytes\n", at24cm0x_async_status(), sim_bus_bytes);
+	
+	if(at24cm0x_async_status() != AT24CM0X_Status_TWI_Error || sim_buffer_transfers != 0)
+	{
+		return 4;
+	}
+	sim_present[0] = 1;
+	sim_memory[0][0x40] = 0x5A;
+	
+	if(at24cm0x_read_async(0x40, data, sizeof(data), 0) != AT24CM0X_Status_Done)
+	{
+		return 5;
+	}
+	run();
+	
+	return !(at24cm0x_async_status() == AT24CM0X_Status_Done && data[0] == sim_memory[0][0x40] && sim_buffer_transfers == 1);
+}
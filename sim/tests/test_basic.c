@@ -0,0 +1,41 @@
+/* Page split writes, sequential reads and the size check against the end of the memory. */
+#include <stdio.h>
+#include <string.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+int main(void)
+{
+	unsigned char data[1024];
+	unsigned char result[1024];
+	
+	for (unsigned int i=0; i < sizeof(data); i++)
+	{
+		data[i] = (unsigned char)(i * 7 + 1);
+	}
+	at24cm0x_init();
+	sim_reset();
+	
+	if(at24cm0x_write(100, data, sizeof(data)) != AT24CM0X_Status_Done || memcmp(sim_memory[0] + 100, data, sizeof(data)))
+	{
+		return 1;
+	}
+	printf("1 KiB at offset 100: %lu write cycles\n", sim_write_cycles);
+	
+	if(at24cm0x_read_sequential(100, result, sizeof(result)) != AT24CM0X_Status_Done || memcmp(result, data, sizeof(data)))
+	{
+		return 2;
+	}
+	
+	if(at24cm0x_write(SIM_MEMORY_SIZE - 10, data, 11) != AT24CM0X_Status_Size_Error)
+	{
+		return 3;
+	}
+	
+	if(at24cm0x_write(0x3F000UL, data, 256) != AT24CM0X_Status_Done || memcmp(sim_memory[0] + 0x3F000UL, data, 256))
+	{
+		return 4;
+	}
+	return 0;
+}
@@ -0,0 +1,52 @@
+/* A failed batch stops at the first bus error and marks the transfers it did not complete. */
+#include <stdio.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+int main(void)
+{
+	unsigned char first[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	unsigned char second[8] = { 9, 9, 9, 9, 9, 9, 9, 9 };
+	unsigned char result_first[4];
+	unsigned char result_second[4];
+	
+	at24cm0x_init();
+	
+	AT24CM0X_Transfer writes[] = {
+		{ .address = 0, .data = first, .size = sizeof(first), .direction = AT24CM0X_Direction_Write },
+		{ .address = 8, .data = second, .size = sizeof(second), .direction = AT24CM0X_Direction_Write }
+	};
+	
+	unsigned long bytes = sim_bus_bytes;
+	sim_fail_after(1);
+	
+	if(at24cm0x_batch(writes, 2) != AT24CM0X_Status_TWI_Error || (sim_bus_bytes - bytes) > 4)
+	{
+		return 1;
+	}
+	
+	if(at24cm0x_batch(writes, 2) != AT24CM0X_Status_Done)
+	{
+		return 2;
+	}
+	
+	AT24CM0X_Transfer reads[] = {
+		{ .address = 0, .data = result_first, .size = sizeof(result_first), .direction = AT24CM0X_Direction_Read },
+		{ .address = 6, .data = result_second, .size = sizeof(result_second), .direction = AT24CM0X_Direction_Read }
+	};
+	
+	bytes = sim_bus_bytes;
+	sim_fail_after(5);
+	
+	if(at24cm0x_batch(reads, 2) != AT24CM0X_Status_TWI_Error || (sim_bus_bytes - bytes) > 7 || reads[1].status != AT24CM0X_Status_TWI_Error)
+	{
+		return 3;
+	}
+	
+	if(at24cm0x_batch(reads, 2) != AT24CM0X_Status_Done || result_second[2] != 9 || result_first[3] != 4)
+	{
+		return 4;
+	}
+	return 0;
+}
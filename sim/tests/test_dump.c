@@ -0,0 +1,70 @@
+/* The dump clamps its last block to the memory size and calls the consumer outside of the bus lock. */
+#include <stdio.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+static int locked;
+static int locked_calls;
+static unsigned long dumped;
+static unsigned int last;
+
+void at24cm0x_os_lock(void)
+{
+	locked++;
+}
+
+void at24cm0x_os_unlock(void)
+{
+	locked--;
+}
+
+void at24cm0x_os_sleep(unsigned int ms)
+{
+	sim_time_us += ms * 1000UL;
+}
+
+void at24cm0x_os_yield(void)
+{
+}
+
+static AT24CM0X_Status check_page(unsigned long address, unsigned char *data, unsigned int size)
+{
+	if(locked)
+	{
+		locked_calls++;
+	}
+	
+	for (unsigned int i=0; i < size; i++)
+	{
+		if(*(data + i) != sim_memory[0][address + i])
+		{
+			return AT24CM0X_Status_Data_Error;
+		}
+	}
+	dumped += size;
+	last = size;
+	
+	return AT24CM0X_Status_Done;
+}
+
+int main(void)
+{
+	AT24CM0X_Device device;
+	
+	for (unsigned long i=0; i < SIM_MEMORY_SIZE; i++)
+	{
+		sim_memory[0][i] = (unsigned char)(i * 11);
+	}
+	at24cm0x_init();
+	at24cm0x_device_init(&device, 0x04);
+	device.size = 1000;
+	
+	if(at24cm0x_device_dump(&device, check_page) != AT24CM0X_Status_Done)
+	{
+		return 1;
+	}
+	printf("dumped %lu bytes, last block %u, %d calls with the bus locked\n", dumped, last, locked_calls);
+	
+	return !(dumped == 1000 && last == (1000 % AT24CM0X_PAGE_SIZE) && locked_calls == 0 && locked == 0);
+}
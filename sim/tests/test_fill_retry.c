@@ -0,0 +1,28 @@
+/* A bus error during at24cm0x_fill is retried and the whole range is written. */
+#include <stdio.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+int main(void)
+{
+	at24cm0x_init();
+	sim_reset();
+	
+	sim_fail_after(1);
+	
+	if(at24cm0x_fill(0x100, 0x5A, 256) != AT24CM0X_Status_Done)
+	{
+		return 1;
+	}
+	printf("fill with error: %lu bus bytes, %lu write cycles\n", sim_bus_bytes, sim_write_cycles);
+	
+	for (unsigned int i=0; i < 256; i++)
+	{
+		if(sim_memory[0][0x100 + i] != 0x5A)
+		{
+			return 2;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,43 @@
+/* Values written through the write cache are on the device with their index entry once at24cm0x_kv_set returns. */
+#include <stdio.h>
+#include <string.h>
+
+#include "at24cm0x_kv.h"
+#include "../twi_sim.h"
+
+int main(void)
+{
+	AT24CM0X_Device device;
+	AT24CM0X_KV kv;
+	unsigned char data[AT24CM0X_KV_VALUE_SIZE];
+	unsigned int length;
+	
+	memset(sim_memory, 0xFF, sizeof(sim_memory));
+	at24cm0x_init();
+	at24cm0x_device_init(&device, 0x04);
+	
+	if(at24cm0x_kv_open(&kv, &device, 96, 16) != AT24CM0X_Status_Done || at24cm0x_kv_format(&kv) != AT24CM0X_Status_Done)
+	{
+		return 1;
+	}
+	
+	if(at24cm0x_kv_set(&kv, 7, (const unsigned char *)"abc", 3) != AT24CM0X_Status_Done || at24cm0x_kv_set(&kv, 7, (const unsigned char *)"defg", 4) != AT24CM0X_Status_Done)
+	{
+		return 2;
+	}
+	
+	const unsigned char *entry = sim_memory[0] + kv.address + (7 * 4UL);
+	unsigned int slot = ((unsigned int)entry[2]) | ((unsigned int)entry[3]<<8);
+	const unsigned char *value = sim_memory[0] + kv.data + (slot * AT24CM0X_KV_SLOT_SIZE);
+	
+	if(entry[0] != 7 || entry[1] != 0 || slot >= kv.slots || value[0] != 7 || value[2] != 4 || memcmp(value + AT24CM0X_KV_HEADER_SIZE, "defg", 4))
+	{
+		return 3;
+	}
+	
+	if(at24cm0x_kv_get(&kv, 7, data, sizeof(data), &length) != AT24CM0X_Status_Done || length != 4 || memcmp(data, "defg", 4))
+	{
+		return 4;
+	}
+	return 0;
+}
@@ -0,0 +1,49 @@
+/* A torn newest record in a wrapped log is not counted, all remaining records stay readable. */
+#include <stdio.h>
+
+#include "at24cm0x_log.h"
+#include "../twi_sim.h"
+
+int main(void)
+{
+	AT24CM0X_Log log;
+	AT24CM0X_Log opened;
+	unsigned char record[4] = { 0 };
+	unsigned int length;
+	
+	at24cm0x_init();
+	AT24CM0X_Device *device = at24cm0x_device_handle(0x00);
+	
+	if(at24cm0x_log_open(&log, device, 4, 1) != AT24CM0X_Status_Done || at24cm0x_log_format(&log) != AT24CM0X_Status_Done)
+	{
+		return 1;
+	}
+	
+	for (unsigned long i=0; i < (log.slots + 3); i++)
+	{
+		record[0] = (unsigned char)i;
+		
+		if(at24cm0x_log_append(&log, record, sizeof(record)) != AT24CM0X_Status_Done)
+		{
+			return 2;
+		}
+	}
+	
+	unsigned long newest = (log.head + log.slots - 1) % log.slots;
+	
+	sim_memory[1][(4UL * 256UL) + (newest * AT24CM0X_LOG_SLOT_SIZE) + AT24CM0X_LOG_HEADER_SIZE] ^= 0xFF;
+	
+	if(at24cm0x_log_open(&opened, device, 4, 1) != AT24CM0X_Status_Done || opened.count != (opened.slots - 1))
+	{
+		return 3;
+	}
+	
+	for (unsigned long age=0; age < opened.count; age++)
+	{
+		if(at24cm0x_log_read(&opened, age, record, sizeof(record), &length) != AT24CM0X_Status_Done)
+		{
+			return 4;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,26 @@
+/* The timeout of a parallel write job includes the transfers to the other devices. */
+#include <stdio.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+static unsigned char data[AT24CM0X_PAGE_SIZE];
+
+int main(void)
+{
+	at24cm0x_init();
+	sim_reset();
+	
+	// Longer than the timeout after the end of a transfer, shorter than the timeout after the end of both transfers
+	sim_write_cycle_us = ((AT24CM0X_WRITE_TIMEOUT_MS * 1000UL) * 6UL) / 5UL;
+	
+	AT24CM0X_Write_Job jobs[] = {
+		{ .identifier = 0x04, .address = 0, .data = data, .size = sizeof(data) },
+		{ .identifier = 0x00, .address = 0, .data = data, .size = sizeof(data) }
+	};
+	
+	AT24CM0X_Status status = at24cm0x_write_parallel(jobs, 2);
+	printf("jobs: status %d and %d after %lu us\n", jobs[0].status, jobs[1].status, sim_time_us);
+	
+	return !(status == AT24CM0X_Status_Timeout && jobs[0].status == AT24CM0X_Status_Timeout && jobs[1].status == AT24CM0X_Status_Timeout);
+}
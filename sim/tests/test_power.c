@@ -0,0 +1,66 @@
+/* at24cm0x_power_down flushes the write queue and a later access powers the device up again. */
+#include <stdio.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+static int powered;
+static int power_ups;
+static unsigned long slept_ms;
+
+void at24cm0x_power(AT24CM0X_Power_Mode mode)
+{
+	if(mode == AT24CM0X_Power_Mode_On)
+	{
+		powered = 1;
+		power_ups++;
+	}
+	else
+	{
+		powered = 0;
+	}
+}
+
+void at24cm0x_power_sleep(unsigned int ms)
+{
+	slept_ms += ms;
+	sim_time_us += ms * 1000UL;
+}
+
+int main(void)
+{
+	unsigned char data[40];
+	
+	at24cm0x_init();
+	sim_reset();
+	
+	for (unsigned int i=0; i < sizeof(data); i++)
+	{
+		if(at24cm0x_write_byte(100 + i, (unsigned char)i) != AT24CM0X_Status_Done)
+		{
+			return 1;
+		}
+	}
+	
+	if(at24cm0x_power_down() != AT24CM0X_Status_Done)
+	{
+		return 2;
+	}
+	printf("power down: %lu write cycles, %lu ms slept, %lu ms blocked\n", sim_write_cycles, slept_ms, sim_waited_ms);
+	
+	if(at24cm0x_read_sequential(100, data, sizeof(data)) != AT24CM0X_Status_Done)
+	{
+		return 3;
+	}
+	
+	for (unsigned int i=0; i < sizeof(data); i++)
+	{
+		if(data[i] != i)
+		{
+			return 4;
+		}
+	}
+	at24cm0x_power_down();
+	
+	return !(power_ups == 2 && sim_waited_ms == 0 && !powered);
+}
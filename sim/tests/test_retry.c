@@ -0,0 +1,51 @@
+/* A single bus error during a page write, a sequential read and a fill is retried. */
+#include <stdio.h>
+#include <string.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+int main(void)
+{
+	unsigned char data[256];
+	unsigned char result[256];
+	
+	for (unsigned int i=0; i < sizeof(data); i++)
+	{
+		data[i] = (unsigned char)(i * 3 + 1);
+	}
+	at24cm0x_init();
+	sim_reset();
+	
+	sim_fail_after(100);
+	
+	if(at24cm0x_write_page(2, data, sizeof(data)) != AT24CM0X_Status_Done || memcmp(sim_memory[0] + 512, data, sizeof(data)))
+	{
+		return 1;
+	}
+	printf("page write with error: %lu write cycles, %lu bus bytes\n", sim_write_cycles, sim_bus_bytes);
+	
+	sim_fail_after(150);
+	
+	if(at24cm0x_read_sequential(512, result, sizeof(result)) != AT24CM0X_Status_Done || memcmp(result, data, sizeof(data)))
+	{
+		return 2;
+	}
+	unsigned long bytes = sim_bus_bytes;
+	sim_fail_after(10);
+	
+	if(at24cm0x_fill(0x300, 0x33, 256) != AT24CM0X_Status_Done)
+	{
+		return 3;
+	}
+	printf("fill with error: %lu bus bytes\n", (sim_bus_bytes - bytes));
+	
+	for (unsigned int i=0; i < 256; i++)
+	{
+		if(sim_memory[0][0x300 + i] != 0x33)
+		{
+			return 4;
+		}
+	}
+	return ((sim_bus_bytes - bytes) < (2 * (3 + 256)) ? 0 : 5);
+}
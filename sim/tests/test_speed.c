@@ -0,0 +1,43 @@
+/* Speed profiles per transfer type and the fall back to the safe profile after repeated errors. */
+#include <stdio.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+int main(void)
+{
+	unsigned char data[64] = { 1, 2, 3 };
+	
+	at24cm0x_init();
+	
+	if(at24cm0x_write(0, data, sizeof(data)) != AT24CM0X_Status_Done || sim_frequency != 400000UL)
+	{
+		return 1;
+	}
+	
+	if(at24cm0x_read_sequential(0, data, sizeof(data)) != AT24CM0X_Status_Done || sim_frequency != 1000000UL)
+	{
+		return 2;
+	}
+	
+	for (unsigned int i=0; i < 3; i++)
+	{
+		sim_fail_after(2);
+		at24cm0x_read_sequential(0, data, 8);
+	}
+	printf("profile %d at %lu Hz after %lu changes\n", at24cm0x_speed_current(), sim_frequency, sim_frequency_changes);
+	
+	if(at24cm0x_speed_current() != AT24CM0X_Speed_Profile_Safe)
+	{
+		return 3;
+	}
+	
+	if(at24cm0x_read_sequential(0, data, 8) != AT24CM0X_Status_Done || sim_frequency != 100000UL)
+	{
+		return 4;
+	}
+	at24cm0x_speed_profile(AT24CM0X_Speed_Profile_Fast);
+	at24cm0x_read_sequential(0, data, 8);
+	
+	return (sim_frequency == 1000000UL ? 0 : 5);
+}
@@ -0,0 +1,36 @@
+/* Typed helpers across a page boundary and the untouched value on a failed read. */
+#include <stdio.h>
+
+#include "at24cm0x.h"
+#include "../twi_sim.h"
+
+int main(void)
+{
+	uint16_t half;
+	uint32_t word;
+	float real;
+	
+	at24cm0x_init();
+	
+	if(at24cm0x_write_u16(10, 0xBEEF) != AT24CM0X_Status_Done || at24cm0x_write_u32(254, 0x12345678UL) != AT24CM0X_Status_Done || at24cm0x_write_float(600, 3.25f) != AT24CM0X_Status_Done)
+	{
+		return 1;
+	}
+	
+	if(at24cm0x_read_u16(10, &half) != AT24CM0X_Status_Done || at24cm0x_read_u32(254, &word) != AT24CM0X_Status_Done || at24cm0x_read_float(600, &real) != AT24CM0X_Status_Done)
+	{
+		return 2;
+	}
+	
+	if(half != 0xBEEF || word != 0x12345678UL || real != 3.25f)
+	{
+		return 3;
+	}
+	sim_present[0] = 0;
+	
+	if(at24cm0x_read_u32(254, &word) == AT24CM0X_Status_Done || word != 0x12345678UL)
+	{
+		return 4;
+	}
+	return 0;
+}
@@ -0,0 +1,305 @@
+/**
+ * @file twi_sim.c
+ * 
+ * @brief Simulated TWI bus with AT24CM02 devices for host tests and benchmarks.
+ * 
+ * Besides the TWI functions of the HAL, the file implements the optional HAL contract of the driver (buffered transfers, repeated start, bus recovery and clock switching), systick_timer_wait_ms and at24cm0x_timestamp on the virtual clock.
+ */
+
+#include <string.h>
+
+#include "hal/sim/twi/twi.h"
+#include "utils/systick/systick.h"
+#include "twi_sim.h"
+
+unsigned char sim_memory[SIM_DEVICES][SIM_MEMORY_SIZE];
+unsigned char sim_present[SIM_DEVICES] = { 1, 1 };
+
+unsigned long sim_time_us;
+unsigned long sim_waited_ms;
+unsigned long sim_bus_bytes;
+unsigned long sim_starts;
+unsigned long sim_buffer_transfers;
+unsigned long sim_write_cycles;
+unsigned long sim_write_cycle_us = 5000UL;
+unsigned long sim_frequency = 400000UL;
+unsigned long sim_frequency_changes;
+long sim_fail_at_byte = -1;
+
+enum Sim_State_t
+{
+	Sim_State_Idle = 0,
+	Sim_State_Address_High,
+	Sim_State_Address_Low,
+	Sim_State_Data,
+	Sim_State_Read,
+	Sim_State_Done
+};
+
+static enum Sim_State_t sim_state;
+static unsigned char sim_device;
+static unsigned char sim_high;
+static unsigned char sim_middle;
+static unsigned long sim_counter[SIM_DEVICES];
+static unsigned long sim_busy_until[SIM_DEVICES];
+
+static unsigned char sim_page[256];
+static unsigned char sim_page_mask[256];
+static unsigned char sim_pending;
+
+static TWI_Error sim_buffer_error;
+static unsigned char sim_buffer_polls;
+
+static TWI_Error sim_byte(void)
+{
+	sim_time_us += (9000000UL + (sim_frequency / 2)) / sim_frequency;
+	
+	unsigned long position = sim_bus_bytes++;
+	
+	if(sim_fail_at_byte >= 0 && (long)position == sim_fail_at_byte)
+	{
+		sim_fail_at_byte = -1;
+		return TWI_Error_Data;
+	}
+	return TWI_None;
+}
+
+static void sim_commit(void)
+{
+	if(!sim_pending)
+	{
+		return;
+	}
+	unsigned long base = sim_counter[sim_device] & ~0xFFUL;
+	
+	for (unsigned int i=0; i < 256; i++)
+	{
+		if(sim_page_mask[i])
+		{
+			sim_memory[sim_device][base | i] = sim_page[i];
+		}
+	}
+	memset(sim_page_mask, 0, sizeof(sim_page_mask));
+	
+	sim_busy_until[sim_device] = sim_time_us + sim_write_cycle_us;
+	sim_write_cycles++;
+	sim_pending = 0;
+}
+
+void sim_reset(void)
+{
+	sim_time_us = 0;
+	sim_waited_ms = 0;
+	sim_bus_bytes = 0;
+	sim_starts = 0;
+	sim_buffer_transfers = 0;
+	sim_write_cycles = 0;
+	sim_frequency_changes = 0;
+	sim_fail_at_byte = -1;
+	
+	memset(sim_busy_until, 0, sizeof(sim_busy_until));
+}
+
+void sim_fail_after(unsigned long offset)
+{
+	sim_fail_at_byte = (long)(sim_bus_bytes + offset);
+}
+
+unsigned long sim_ms(void)
+{
+	return sim_time_us / 1000UL;
+}
+
+void twi_init(void)
+{
+	sim_state = Sim_State_Idle;
+}
+
+void twi_start(void)
+{
+	sim_starts++;
+	sim_state = Sim_State_Idle;
+	sim_time_us += 5;
+}
+
+void twi_restart(void)
+{
+	twi_start();
+}
+
+void twi_stop(void)
+{
+	if(sim_state == Sim_State_Data)
+	{
+		sim_commit();
+	}
+	sim_state = Sim_State_Idle;
+	sim_time_us += 5;
+}
+
+void twi_recover(void)
+{
+	sim_pending = 0;
+	memset(sim_page_mask, 0, sizeof(sim_page_mask));
+	
+	twi_stop();
+}
+
+void twi_frequency(unsigned long frequency)
+{
+	sim_frequency = frequency;
+	sim_frequency_changes++;
+}
+
+TWI_Error twi_address(unsigned char address, TWI_Operation operation)
+{
+	TWI_Error error = sim_byte();
+	
+	if(error != TWI_None)
+	{
+		return error;
+	}
+	
+	if((address & 0x7C) == 0x54)
+	{
+		sim_device = 0;
+	}
+	else if((address & 0x7C) == 0x50)
+	{
+		sim_device = 1;
+	}
+	else
+	{
+		sim_state = Sim_State_Idle;
+		return (TWI_Error)TWI_Ack;
+	}
+	
+	if(!sim_present[sim_device] || sim_time_us < sim_busy_until[sim_device])
+	{
+		sim_state = Sim_State_Idle;
+		return (TWI_Error)TWI_Ack;
+	}
+	
+	if(operation == TWI_Write)
+	{
+		sim_high = (address & 0x03);
+		sim_state = Sim_State_Address_High;
+	}
+	else
+	{
+		sim_state = Sim_State_Read;
+	}
+	return TWI_None;
+}
+
+TWI_Error twi_set(unsigned char data)
+{
+	TWI_Error error = sim_byte();
+	
+	if(error != TWI_None)
+	{
+		return error;
+	}
+	
+	switch(sim_state)
+	{
+		case Sim_State_Address_High:
+			sim_middle = data;
+			sim_state = Sim_State_Address_Low;
+		break;
+		case Sim_State_Address_Low:
+			sim_counter[sim_device] = ((unsigned long)sim_high<<16) | ((unsigned long)sim_middle<<8) | data;
+			sim_state = Sim_State_Data;
+		break;
+		case Sim_State_Data:
+		{
+			unsigned int offset = (unsigned int)(sim_counter[sim_device] & 0xFF);
+			
+			sim_page[offset] = data;
+			sim_page_mask[offset] = 1;
+			sim_pending = 1;
+			sim_counter[sim_device] = (sim_counter[sim_device] & ~0xFFUL) | ((offset + 1) & 0xFF);
+		}
+		break;
+		default:
+			return TWI_Error_Data;
+	}
+	return TWI_None;
+}
+
+TWI_Error twi_get(unsigned char *data, TWI_Operation acknowledge)
+{
+	TWI_Error error = sim_byte();
+	
+	if(error != TWI_None)
+	{
+		return error;
+	}
+	
+	if(sim_state != Sim_State_Read)
+	{
+		return TWI_Error_Data;
+	}
+	*data = sim_memory[sim_device][sim_counter[sim_device]];
+	sim_counter[sim_device] = (sim_counter[sim_device] + 1) % SIM_MEMORY_SIZE;
+	
+	if(acknowledge == TWI_NACK)
+	{
+		sim_state = Sim_State_Done;
+	}
+	return TWI_None;
+}
+
+TWI_Error twi_buffer_set(const unsigned char *data, unsigned int size)
+{
+	sim_buffer_error = TWI_None;
+	
+	for (unsigned int i=0; i < size && sim_buffer_error == TWI_None; i++)
+	{
+		sim_buffer_error |= twi_set(*(data + i));
+	}
+	sim_buffer_polls = 3;
+	sim_buffer_transfers++;
+	
+	return TWI_None;
+}
+
+TWI_Error twi_buffer_get(unsigned char *data, unsigned int size)
+{
+	sim_buffer_error = TWI_None;
+	
+	for (unsigned int i=0; i < size && sim_buffer_error == TWI_None; i++)
+	{
+		sim_buffer_error |= twi_get((data + i), ((i + 1) == size ? TWI_NACK : TWI_Ack));
+	}
+	sim_buffer_polls = 3;
+	sim_buffer_transfers++;
+	
+	return TWI_None;
+}
+
+unsigned char twi_buffer_busy(void)
+{
+	if(sim_buffer_polls)
+	{
+		sim_buffer_polls--;
+		return 1;
+	}
+	return 0;
+}
+
+TWI_Error twi_buffer_status(void)
+{
+	return sim_buffer_error;
+}
+
+void systick_timer_wait_ms(unsigned int ms)
+{
+	sim_time_us += ms * 1000UL;
+	sim_waited_ms += ms;
+}
+
+unsigned long at24cm0x_timestamp(void)
+{
+	return sim_ms();
+}
@@ -0,0 +1,45 @@
+/**
+ * @file twi_sim.h
+ * @brief State of the simulated TWI bus and EEPROM devices.
+ * 
+ * The model keeps two AT24CM02 devices, a virtual clock and counters for the bus traffic. Index 0 answers to the default single device address (0x54, A2 = 1), index 1 to the device selector 0x00 (0x50).
+ * 
+ * The model covers what the driver relies on: the internal address counter with roll-over at the page boundary on writes and at the end of the memory on reads, a write cycle of @ref sim_write_cycle_us during which the device does not acknowledge its address, and a bus time per byte that follows the clock set with twi_frequency.
+ */
+
+#ifndef TWI_SIM_H_
+#define TWI_SIM_H_
+
+	#define SIM_DEVICES 2
+	#define SIM_MEMORY_SIZE 262144UL
+	
+	extern unsigned char sim_memory[SIM_DEVICES][SIM_MEMORY_SIZE];  /**< Contents of the devices. */
+	extern unsigned char sim_present[SIM_DEVICES];                  /**< Devices that acknowledge their address. */
+	
+	extern unsigned long sim_time_us;        /**< Virtual time. */
+	extern unsigned long sim_waited_ms;      /**< Time spent in systick_timer_wait_ms. */
+	extern unsigned long sim_bus_bytes;      /**< Bytes clocked on the bus (address and data). */
+	extern unsigned long sim_starts;         /**< Start conditions. */
+	extern unsigned long sim_buffer_transfers; /**< Transfers handed to twi_buffer_set or twi_buffer_get. */
+	extern unsigned long sim_write_cycles;   /**< Internal write cycles started. */
+	extern unsigned long sim_write_cycle_us; /**< Duration of an internal write cycle. */
+	extern unsigned long sim_frequency;      /**< Bus clock in Hz, set by twi_frequency. */
+	extern unsigned long sim_frequency_changes;
+	extern long sim_fail_at_byte;            /**< Bus byte index that fails with TWI_Error_Data once, -1 disables. */
+	
+	/**
+	 * @brief Clears the counters, the clock and all pending write cycles.
+	 */
+	void sim_reset(void);
+	
+	/**
+	 * @brief Injects a single TWI error @p offset bytes after the current bus position.
+	 */
+	void sim_fail_after(unsigned long offset);
+	
+	/**
+	 * @brief Returns the virtual time in milliseconds.
+	 */
+	unsigned long sim_ms(void);
+
+#endif /* TWI_SIM_H_ */
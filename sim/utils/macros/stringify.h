@@ -0,0 +1,7 @@
+#ifndef STRINGIFY_H_
+#define STRINGIFY_H_
+
+	#define _STR_(x) #x
+	#define _STR(x) _STR_(x)
+
+#endif /* STRINGIFY_H_ */
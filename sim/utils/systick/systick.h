@@ -0,0 +1,6 @@
+#ifndef SYSTICK_H_
+#define SYSTICK_H_
+
+	void systick_timer_wait_ms(unsigned int ms);
+
+#endif /* SYSTICK_H_ */